@@ -24,11 +24,13 @@
  */
 
 #include "common/global.hpp"
+#include "common/timer-wheel.hpp"
 
 namespace nfd {
 
 static thread_local std::unique_ptr<boost::asio::io_context> g_ioCtx;
 static thread_local std::unique_ptr<ndn::Scheduler> g_scheduler;
+static thread_local std::unique_ptr<TimerWheel> g_timerWheel;
 static boost::asio::io_context* g_mainIoCtx = nullptr;
 static boost::asio::io_context* g_ribIoCtx = nullptr;
 
@@ -50,10 +52,20 @@ getScheduler()
   return *g_scheduler;
 }
 
+TimerWheel&
+getTimerWheel()
+{
+  if (g_timerWheel == nullptr) {
+    g_timerWheel = std::make_unique<TimerWheel>(getScheduler());
+  }
+  return *g_timerWheel;
+}
+
 #ifdef NFD_WITH_TESTS
 void
 resetGlobalIoService()
 {
+  g_timerWheel.reset();
   g_scheduler.reset();
   g_ioCtx.reset();
 }
@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/memory-pool.hpp"
+
+#include <algorithm>
+
+namespace nfd {
+
+static std::vector<const MemoryPool*>&
+getPoolRegistry()
+{
+  static std::vector<const MemoryPool*> pools;
+  return pools;
+}
+
+MemoryPool::MemoryPool(std::string name, size_t blocksPerChunk)
+  : m_name(std::move(name))
+  , m_blocksPerChunk(blocksPerChunk)
+{
+  BOOST_ASSERT(m_blocksPerChunk > 0);
+  getPoolRegistry().push_back(this);
+}
+
+MemoryPool::~MemoryPool()
+{
+  BOOST_ASSERT(m_nInUse == 0);
+  auto& pools = getPoolRegistry();
+  pools.erase(std::remove(pools.begin(), pools.end(), this), pools.end());
+}
+
+const std::vector<const MemoryPool*>&
+MemoryPool::getPools()
+{
+  return getPoolRegistry();
+}
+
+void*
+MemoryPool::allocate(size_t size)
+{
+  if (m_blockSize == 0) {
+    // each block must be able to hold a FreeBlock, and must keep the next block aligned
+    constexpr size_t align = alignof(std::max_align_t);
+    m_blockSize = (std::max(size, sizeof(FreeBlock)) + align - 1) / align * align;
+  }
+  else if (size > m_blockSize) {
+    return ::operator new(size);
+  }
+
+  if (m_freeList == nullptr) {
+    this->addChunk();
+  }
+
+  FreeBlock* block = m_freeList;
+  m_freeList = block->next;
+  ++m_nInUse;
+  return block;
+}
+
+void
+MemoryPool::deallocate(void* ptr, size_t size) noexcept
+{
+  if (ptr == nullptr) {
+    return;
+  }
+  if (size > m_blockSize) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  BOOST_ASSERT(m_nInUse > 0);
+  auto block = static_cast<FreeBlock*>(ptr);
+  block->next = m_freeList;
+  m_freeList = block;
+  --m_nInUse;
+}
+
+void
+MemoryPool::addChunk()
+{
+  auto& chunk = m_chunks.emplace_back(new std::byte[m_blocksPerChunk * m_blockSize]);
+
+  // thread the new blocks onto the free list, so that they are handed out in address order
+  for (size_t i = m_blocksPerChunk; i > 0; --i) {
+    auto block = reinterpret_cast<FreeBlock*>(chunk.get() + (i - 1) * m_blockSize);
+    block->next = m_freeList;
+    m_freeList = block;
+  }
+}
+
+} // namespace nfd
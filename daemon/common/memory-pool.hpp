@@ -0,0 +1,197 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_MEMORY_POOL_HPP
+#define NFD_DAEMON_COMMON_MEMORY_POOL_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+
+/**
+ * \brief Allocates fixed-size memory blocks from large chunks.
+ *
+ * Freed blocks are kept in a free list and handed out again by subsequent allocations, so that
+ * objects created and destroyed at high rates (e.g., name tree nodes) do not go through
+ * malloc/free and do not fragment the heap. Memory is not returned to the system until the
+ * pool is destroyed: the pool's capacity stays at its high-water mark.
+ *
+ * The block size is determined by the first allocation. Larger allocations are forwarded to
+ * the global `operator new`.
+ *
+ * \note MemoryPool is not thread-safe.
+ */
+class MemoryPool : noncopyable
+{
+public:
+  explicit
+  MemoryPool(std::string name, size_t blocksPerChunk = 256);
+
+  /**
+   * \pre All blocks have been deallocated.
+   */
+  ~MemoryPool();
+
+  void*
+  allocate(size_t size);
+
+  void
+  deallocate(void* ptr, size_t size) noexcept;
+
+  const std::string&
+  getName() const noexcept
+  {
+    return m_name;
+  }
+
+  /**
+   * \brief Returns the size of each block, or zero if nothing has been allocated yet.
+   */
+  size_t
+  getBlockSize() const noexcept
+  {
+    return m_blockSize;
+  }
+
+  /**
+   * \brief Returns the number of blocks currently allocated.
+   */
+  size_t
+  getNInUse() const noexcept
+  {
+    return m_nInUse;
+  }
+
+  /**
+   * \brief Returns the number of blocks obtained from the system, either in use or free.
+   */
+  size_t
+  getCapacity() const noexcept
+  {
+    return m_chunks.size() * m_blocksPerChunk;
+  }
+
+  /**
+   * \brief Returns all MemoryPool instances in existence, in order of creation.
+   */
+  static const std::vector<const MemoryPool*>&
+  getPools();
+
+private:
+  void
+  addChunk();
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  std::string m_name;
+  size_t m_blocksPerChunk;
+  size_t m_blockSize = 0;
+  size_t m_nInUse = 0;
+  FreeBlock* m_freeList = nullptr;
+  std::vector<unique_ptr<std::byte[]>> m_chunks;
+};
+
+/**
+ * \brief Returns the MemoryPool identified by \p Tag.
+ *
+ * The pool is created on first use and lives until the program exits. It is intentionally
+ * never destroyed, so that objects freed during static destruction can still be returned to it.
+ *
+ * \tparam Tag a type with a `static constexpr const char* POOL_NAME` member
+ */
+template<typename Tag>
+MemoryPool&
+getMemoryPool()
+{
+  static MemoryPool* pool = new MemoryPool(Tag::POOL_NAME);
+  return *pool;
+}
+
+/**
+ * \brief Standard allocator that obtains single objects from getMemoryPool<Tag>().
+ *
+ * Requests for more than one object, which node-based containers and `std::allocate_shared`
+ * never make, are forwarded to `std::allocator`.
+ */
+template<typename T, typename Tag>
+class PoolAllocator
+{
+public:
+  using value_type = T;
+
+  template<typename U>
+  struct rebind
+  {
+    using other = PoolAllocator<U, Tag>;
+  };
+
+  PoolAllocator() noexcept = default;
+
+  template<typename U>
+  PoolAllocator(const PoolAllocator<U, Tag>&) noexcept
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    if (n != 1) {
+      return std::allocator<T>().allocate(n);
+    }
+    return static_cast<T*>(getMemoryPool<Tag>().allocate(sizeof(T)));
+  }
+
+  void
+  deallocate(T* ptr, size_t n) noexcept
+  {
+    if (n != 1) {
+      std::allocator<T>().deallocate(ptr, n);
+      return;
+    }
+    getMemoryPool<Tag>().deallocate(ptr, sizeof(T));
+  }
+
+  template<typename U>
+  friend bool
+  operator==(const PoolAllocator&, const PoolAllocator<U, Tag>&) noexcept
+  {
+    return true;
+  }
+
+  template<typename U>
+  friend bool
+  operator!=(const PoolAllocator&, const PoolAllocator<U, Tag>&) noexcept
+  {
+    return false;
+  }
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_MEMORY_POOL_HPP
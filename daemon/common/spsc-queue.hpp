@@ -0,0 +1,173 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_SPSC_QUEUE_HPP
+#define NFD_DAEMON_COMMON_SPSC_QUEUE_HPP
+
+#include "core/common.hpp"
+
+#include <atomic>
+#include <new>
+#include <optional>
+
+namespace nfd {
+
+/**
+ * \brief Bounded lock-free queue with a single producer thread and a single consumer thread.
+ *
+ * The queue is a ring buffer whose capacity is rounded up to a power of two. The producer only
+ * writes the tail index and the consumer only writes the head index, so that push and pop each
+ * need one release store and no read-modify-write operation. Each side also keeps a cached copy
+ * of the other side's index, and reloads it only when the queue appears full or empty.
+ *
+ * \note tryPush() must only be called from one thread, and tryPop() must only be called from
+ *       one (possibly different) thread. size() and empty() may be called from either thread,
+ *       but the result may be out of date by the time it is returned.
+ */
+template<typename T>
+class SpscQueue : noncopyable
+{
+public:
+  explicit
+  SpscQueue(size_t capacity)
+    : m_mask(roundUpCapacity(capacity) - 1)
+    , m_slots(new Slot[m_mask + 1])
+  {
+  }
+
+  ~SpscQueue()
+  {
+    while (tryPop()) {
+    }
+  }
+
+  size_t
+  capacity() const noexcept
+  {
+    return m_mask + 1;
+  }
+
+  /**
+   * \brief Appends an element at the tail of the queue.
+   * \return whether the element was appended; false if the queue is full,
+   *         in which case \p value is not moved from
+   */
+  bool
+  tryPush(T&& value)
+  {
+    size_t tail = m_producer.index.load(std::memory_order_relaxed);
+    if (tail - m_producer.cachedOther > m_mask) {
+      m_producer.cachedOther = m_consumer.index.load(std::memory_order_acquire);
+      if (tail - m_producer.cachedOther > m_mask) {
+        return false;
+      }
+    }
+
+    new (m_slots[tail & m_mask].storage) T(std::move(value));
+    m_producer.index.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool
+  tryPush(const T& value)
+  {
+    T copy(value);
+    return tryPush(std::move(copy));
+  }
+
+  /**
+   * \brief Removes the element at the head of the queue.
+   * \return the element, or nullopt if the queue is empty
+   */
+  std::optional<T>
+  tryPop()
+  {
+    size_t head = m_consumer.index.load(std::memory_order_relaxed);
+    if (head == m_consumer.cachedOther) {
+      m_consumer.cachedOther = m_producer.index.load(std::memory_order_acquire);
+      if (head == m_consumer.cachedOther) {
+        return std::nullopt;
+      }
+    }
+
+    T* slot = std::launder(reinterpret_cast<T*>(m_slots[head & m_mask].storage));
+    std::optional<T> value(std::move(*slot));
+    slot->~T();
+    m_consumer.index.store(head + 1, std::memory_order_release);
+    return value;
+  }
+
+  size_t
+  size() const noexcept
+  {
+    size_t head = m_consumer.index.load(std::memory_order_acquire);
+    size_t tail = m_producer.index.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  bool
+  empty() const noexcept
+  {
+    return size() == 0;
+  }
+
+private:
+  static size_t
+  roundUpCapacity(size_t capacity)
+  {
+    BOOST_ASSERT(capacity > 0);
+    size_t n = 1;
+    while (n < capacity) {
+      n <<= 1;
+    }
+    return n;
+  }
+
+private:
+  /// assumed size of a cache line, to keep producer and consumer state from sharing one
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  struct Slot
+  {
+    alignas(T) std::byte storage[sizeof(T)];
+  };
+
+  struct alignas(CACHE_LINE_SIZE) Side
+  {
+    /// index written by this side and read by the other side
+    std::atomic<size_t> index{0};
+    /// last observed value of the other side's index, accessed only by this side
+    size_t cachedOther = 0;
+  };
+
+  const size_t m_mask;
+  const unique_ptr<Slot[]> m_slots;
+  Side m_producer; ///< index is the tail
+  Side m_consumer; ///< index is the head
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_SPSC_QUEUE_HPP
@@ -0,0 +1,302 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/timer-wheel.hpp"
+
+namespace nfd {
+
+void
+TimerWheel::Timer::cancel() noexcept
+{
+  if (m_wheel != nullptr) {
+    m_wheel->remove(*this);
+  }
+}
+
+TimerWheel::TimerWheel(ndn::Scheduler& scheduler)
+  : m_scheduler(scheduler)
+  , m_currentTick(toTick(time::steady_clock::now()))
+{
+}
+
+TimerWheel::~TimerWheel()
+{
+  auto detachAll = [] (Link& list) {
+    while (list.isLinked()) {
+      auto& timer = static_cast<Timer&>(*list.next);
+      timer.unlink();
+      timer.m_wheel = nullptr;
+    }
+  };
+
+  for (auto& level : m_slots) {
+    for (auto& slot : level) {
+      detachAll(slot);
+    }
+  }
+  detachAll(m_due);
+  detachAll(m_overflow);
+}
+
+uint64_t
+TimerWheel::toTick(time::steady_clock::time_point t) noexcept
+{
+  return static_cast<uint64_t>(
+    time::duration_cast<time::milliseconds>(t.time_since_epoch()).count());
+}
+
+void
+TimerWheel::schedule(Timer& timer, time::nanoseconds after)
+{
+  BOOST_ASSERT(timer.hasCallback());
+  timer.cancel();
+
+  auto now = time::steady_clock::now();
+  if (m_size == 0) {
+    // nothing can expire in between, so catch up with the clock directly
+    m_currentTick = toTick(now);
+  }
+
+  // round up, so that the timer never expires early
+  after = std::max(after, 0_ns);
+  timer.m_expiry = toTick(now + after + 1_ms - 1_ns);
+  timer.m_wheel = this;
+  insert(timer);
+  ++m_size;
+
+  if (!m_tickEvent || timer.m_expiry < m_tickEventTarget) {
+    setTickEvent(std::max(timer.m_expiry, m_currentTick));
+  }
+}
+
+void
+TimerWheel::insert(Timer& timer) noexcept
+{
+  auto append = [&timer] (Link& list) {
+    Link& tail = *list.prev;
+    timer.prev = &tail;
+    timer.next = &list;
+    tail.next = &timer;
+    list.prev = &timer;
+  };
+
+  if (timer.m_expiry <= m_currentTick) {
+    timer.m_level = DUE_LEVEL;
+    append(m_due);
+    return;
+  }
+
+  // the level is determined by the most significant digit in which expiry and current tick differ
+  uint64_t diff = timer.m_expiry ^ m_currentTick;
+  if ((diff >> (SLOT_BITS * N_LEVELS)) != 0) {
+    timer.m_level = OVERFLOW_LEVEL;
+    append(m_overflow);
+    ++m_overflowSize;
+    return;
+  }
+
+  size_t level = 0;
+  while (level < N_LEVELS - 1 && (diff >> (SLOT_BITS * (level + 1))) != 0) {
+    ++level;
+  }
+
+  timer.m_level = level;
+  append(m_slots[level][(timer.m_expiry >> (SLOT_BITS * level)) & (N_SLOTS - 1)]);
+  ++m_levelSize[level];
+}
+
+void
+TimerWheel::remove(Timer& timer) noexcept
+{
+  BOOST_ASSERT(timer.m_wheel == this);
+  timer.unlink();
+  timer.m_wheel = nullptr;
+  if (timer.m_level < N_LEVELS) {
+    --m_levelSize[timer.m_level];
+  }
+  else if (timer.m_level == OVERFLOW_LEVEL) {
+    --m_overflowSize;
+  }
+  --m_size;
+}
+
+void
+TimerWheel::advance(uint64_t target)
+{
+  while (m_currentTick < target) {
+    if (m_levelSize[0] == 0) {
+      // no timer can expire before the next boundary of the lowest non-empty level,
+      // where level N_LEVELS stands for the overflow list
+      size_t level = 1;
+      while (level < N_LEVELS && m_levelSize[level] == 0) {
+        ++level;
+      }
+      if (level == N_LEVELS && m_overflowSize == 0) {
+        m_currentTick = target;
+        return;
+      }
+
+      uint64_t boundary = ((m_currentTick >> (SLOT_BITS * level)) + 1) << (SLOT_BITS * level);
+      if (boundary > target) {
+        m_currentTick = target;
+        return;
+      }
+      m_currentTick = boundary - 1;
+    }
+
+    ++m_currentTick;
+
+    // At each revolution of the top level, redistribute the overflow list. Timers are moved to
+    // a local list first, so that those still beyond the span go back to the overflow list
+    // without being visited again.
+    if ((m_currentTick & ((uint64_t{1} << (SLOT_BITS * N_LEVELS)) - 1)) == 0 &&
+        m_overflow.isLinked()) {
+      Link pending;
+      pending.next = m_overflow.next;
+      pending.prev = m_overflow.prev;
+      pending.next->prev = &pending;
+      pending.prev->next = &pending;
+      m_overflow.next = m_overflow.prev = &m_overflow;
+      m_overflowSize = 0;
+      while (pending.isLinked()) {
+        auto& timer = static_cast<Timer&>(*pending.next);
+        timer.unlink();
+        insert(timer);
+      }
+    }
+
+    // Cascade timers down from every level whose boundary has been crossed, highest first,
+    // so that timers moved into the current slot of a lower level are cascaded again.
+    size_t topLevel = 0;
+    while (topLevel < N_LEVELS - 1 &&
+           (m_currentTick & ((uint64_t{1} << (SLOT_BITS * (topLevel + 1))) - 1)) == 0) {
+      ++topLevel;
+    }
+    for (size_t level = topLevel; level > 0; --level) {
+      Link& slot = m_slots[level][(m_currentTick >> (SLOT_BITS * level)) & (N_SLOTS - 1)];
+      while (slot.isLinked()) {
+        auto& timer = static_cast<Timer&>(*slot.next);
+        timer.unlink();
+        --m_levelSize[level];
+        insert(timer);
+      }
+    }
+
+    expire(m_slots[0][m_currentTick & (N_SLOTS - 1)]);
+    expire(m_due);
+  }
+}
+
+void
+TimerWheel::expire(Link& list)
+{
+  if (!list.isLinked()) {
+    return;
+  }
+
+  // Move the timers to a local list first, so that callbacks can safely arm timers into
+  // the same slot, or cancel timers that have not been processed yet.
+  Link pending;
+  pending.next = list.next;
+  pending.prev = list.prev;
+  pending.next->prev = &pending;
+  pending.prev->next = &pending;
+  list.next = list.prev = &list;
+
+  try {
+    while (pending.isLinked()) {
+      auto& timer = static_cast<Timer&>(*pending.next);
+      remove(timer);
+      timer.m_callback();
+    }
+  }
+  catch (...) {
+    // hand the remaining timers back to the wheel before propagating
+    while (pending.isLinked()) {
+      auto& timer = static_cast<Timer&>(*pending.next);
+      remove(timer);
+      timer.m_wheel = this;
+      timer.m_expiry = m_currentTick;
+      insert(timer);
+      ++m_size;
+    }
+    scheduleTick();
+    throw;
+  }
+}
+
+void
+TimerWheel::onTick()
+{
+  expire(m_due);
+  advance(toTick(time::steady_clock::now()));
+  scheduleTick();
+}
+
+void
+TimerWheel::scheduleTick()
+{
+  if (m_size == 0) {
+    m_tickEvent.cancel();
+    return;
+  }
+
+  uint64_t target = 0;
+  if (m_due.isLinked()) {
+    target = m_currentTick;
+  }
+  else if (m_levelSize[0] > 0) {
+    // level-0 timers are all within the current revolution of that level
+    target = (m_currentTick | (N_SLOTS - 1)) + 1;
+    for (uint64_t tick = m_currentTick + 1; tick < target; ++tick) {
+      if (m_slots[0][tick & (N_SLOTS - 1)].isLinked()) {
+        target = tick;
+        break;
+      }
+    }
+  }
+  else {
+    // level N_LEVELS is reached only if the overflow list holds all pending timers
+    size_t level = 1;
+    while (level < N_LEVELS && m_levelSize[level] == 0) {
+      ++level;
+    }
+    target = ((m_currentTick >> (SLOT_BITS * level)) + 1) << (SLOT_BITS * level);
+  }
+
+  if (!m_tickEvent || target < m_tickEventTarget) {
+    setTickEvent(target);
+  }
+}
+
+void
+TimerWheel::setTickEvent(uint64_t tick)
+{
+  m_tickEventTarget = tick;
+  auto when = time::steady_clock::time_point(time::milliseconds(tick));
+  m_tickEvent = m_scheduler.schedule(when - time::steady_clock::now(), [this] { onTick(); });
+}
+
+} // namespace nfd
@@ -0,0 +1,235 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
+#define NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include <array>
+#include <functional>
+
+namespace nfd {
+
+/**
+ * \brief A hierarchical hashed timer wheel with millisecond granularity.
+ *
+ * Timers are intrusive: a TimerWheel::Timer is embedded in the object it belongs to, and arming,
+ * re-arming, and cancelling it are O(1) operations that do not allocate memory. The wheel has
+ * four levels of 256 slots each; a timer is placed in the lowest level whose span covers its
+ * expiration, and is moved down to lower levels as the wheel turns. Timers further out than
+ * the span of the top level (about 49 days) are kept in an overflow list, which is redistributed
+ * onto the wheel once per revolution of the top level.
+ *
+ * The wheel is driven by a single event on an ndn::Scheduler, which is set to the next tick
+ * at which a timer may expire. A timer never expires earlier than requested, but may expire up
+ * to one millisecond later, because expiration times are rounded up to whole ticks.
+ *
+ * \note TimerWheel is not thread-safe. Use getTimerWheel() to obtain the instance that runs on
+ *       the calling thread's io_context.
+ */
+class TimerWheel : noncopyable
+{
+private:
+  /**
+   * \brief Node of a circular doubly-linked list; a default-constructed Link is an empty list.
+   */
+  struct Link
+  {
+    Link() noexcept
+      : prev(this)
+      , next(this)
+    {
+    }
+
+    bool
+    isLinked() const noexcept
+    {
+      return next != this;
+    }
+
+    void
+    unlink() noexcept
+    {
+      prev->next = next;
+      next->prev = prev;
+      prev = next = this;
+    }
+
+    Link* prev;
+    Link* next;
+  };
+
+public:
+  using Callback = std::function<void()>;
+
+  /**
+   * \brief A timer that can be armed on a TimerWheel.
+   *
+   * The timer is cancelled when it is destroyed. It is permitted to destroy the timer from
+   * within its own callback, provided that the callback does not access its captures afterwards.
+   */
+  class Timer : private Link, noncopyable
+  {
+  public:
+    Timer() = default;
+
+    explicit
+    Timer(Callback callback)
+      : m_callback(std::move(callback))
+    {
+    }
+
+    ~Timer()
+    {
+      cancel();
+    }
+
+    /**
+     * \brief Sets the function invoked when the timer expires.
+     */
+    void
+    setCallback(Callback callback)
+    {
+      m_callback = std::move(callback);
+    }
+
+    bool
+    hasCallback() const noexcept
+    {
+      return static_cast<bool>(m_callback);
+    }
+
+    /**
+     * \brief Returns whether the timer is armed and has not expired yet.
+     */
+    explicit
+    operator bool() const noexcept
+    {
+      return m_wheel != nullptr;
+    }
+
+    /**
+     * \brief Disarms the timer; does nothing if the timer is not armed.
+     */
+    void
+    cancel() noexcept;
+
+  private:
+    Callback m_callback;
+    TimerWheel* m_wheel = nullptr;
+    uint64_t m_expiry = 0; ///< expiration tick
+    size_t m_level = 0; ///< wheel level, or DUE_LEVEL or OVERFLOW_LEVEL
+
+    friend TimerWheel;
+  };
+
+  explicit
+  TimerWheel(ndn::Scheduler& scheduler);
+
+  /**
+   * \brief Disarms all pending timers.
+   */
+  ~TimerWheel();
+
+  /**
+   * \brief Arms \p timer to expire after \p after, re-arming it if it is already pending.
+   * \pre \p timer has a callback
+   */
+  void
+  schedule(Timer& timer, time::nanoseconds after);
+
+  /**
+   * \brief Returns the number of pending timers.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static constexpr size_t SLOT_BITS = 8;
+  static constexpr size_t N_SLOTS = 1 << SLOT_BITS;
+  static constexpr size_t N_LEVELS = 4;
+
+private:
+  /// Timer::m_level of a timer in the list of due timers
+  static constexpr size_t DUE_LEVEL = N_LEVELS;
+  /// Timer::m_level of a timer in the overflow list
+  static constexpr size_t OVERFLOW_LEVEL = N_LEVELS + 1;
+
+  static uint64_t
+  toTick(time::steady_clock::time_point t) noexcept;
+
+  void
+  insert(Timer& timer) noexcept;
+
+  void
+  remove(Timer& timer) noexcept;
+
+  /**
+   * \brief Moves the current tick forward to \p target, expiring timers along the way.
+   */
+  void
+  advance(uint64_t target);
+
+  /**
+   * \brief Expires all timers in \p list.
+   */
+  void
+  expire(Link& list);
+
+  void
+  onTick();
+
+  /**
+   * \brief Sets the scheduler event to the next tick at which a timer may expire.
+   */
+  void
+  scheduleTick();
+
+  void
+  setTickEvent(uint64_t tick);
+
+private:
+  ndn::Scheduler& m_scheduler;
+  ndn::scheduler::ScopedEventId m_tickEvent;
+  uint64_t m_tickEventTarget = 0; ///< tick at which m_tickEvent fires
+
+  std::array<std::array<Link, N_SLOTS>, N_LEVELS> m_slots;
+  std::array<size_t, N_LEVELS> m_levelSize{};
+  Link m_due; ///< timers that are already expired, but have not been processed yet
+  Link m_overflow; ///< timers beyond the span of the top level
+  size_t m_overflowSize = 0;
+  uint64_t m_currentTick = 0; ///< last processed tick
+  size_t m_size = 0;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
@@ -27,26 +27,92 @@
 #define NFD_DAEMON_FACE_DATAGRAM_TRANSPORT_HPP
 
 #include "transport.hpp"
+#include "receive-buffer-pool.hpp"
 #include "socket-utils.hpp"
 #include "common/global.hpp"
 
-#include <array>
-
 #include <boost/asio/defer.hpp>
+#include <boost/asio/post.hpp>
+
+#include <cstring>
+
+#ifdef __linux__
+#include <cerrno>       // for errno
+#include <sys/socket.h> // for recvmmsg() and sendmmsg()
+#endif
 
 namespace nfd::face {
 
 struct Unicast {};
 struct Multicast {};
 
+/**
+ * \brief Counters of batched datagram I/O.
+ */
+class DatagramBatchCounters
+{
+public:
+  /// number of recvmmsg() calls that returned at least one datagram
+  PacketCounter nRxBatches;
+  /// number of datagrams received by recvmmsg()
+  PacketCounter nRxDatagrams;
+  /// number of sendmmsg() calls that sent at least one datagram
+  PacketCounter nTxBatches;
+  /// number of datagrams sent by sendmmsg()
+  PacketCounter nTxDatagrams;
+};
+
+/**
+ * \brief Non-template base class of DatagramTransport.
+ */
+class DatagramTransportBase : public Transport
+{
+public:
+  /**
+   * \brief Returns the maximum number of datagrams received or sent in one system call.
+   *
+   * A batch size of 1 means that batched I/O is disabled.
+   */
+  size_t
+  getBatchSize() const noexcept
+  {
+    return m_batchSize;
+  }
+
+  /**
+   * \brief Returns the batch counters; they stay at zero if batched I/O is disabled.
+   *
+   * The average batch size is nRxDatagrams / nRxBatches for receive,
+   * and nTxDatagrams / nTxBatches for send.
+   */
+  const DatagramBatchCounters&
+  getBatchCounters() const noexcept
+  {
+    return m_batchCounters;
+  }
+
+protected:
+  explicit
+  DatagramTransportBase(size_t batchSize);
+
+protected:
+  const size_t m_batchSize;
+  DatagramBatchCounters m_batchCounters;
+};
+
 /**
  * \brief Implements a Transport for datagram-based protocols.
  *
+ * If the batch size is greater than 1 (Linux only), the transport waits for the socket to become
+ * readable and then drains up to that many datagrams with a single recvmmsg() call. Outgoing
+ * packets are queued and flushed with sendmmsg() once the current event loop handler returns,
+ * or as soon as a full batch has been queued.
+ *
  * \tparam Protocol A datagram-based protocol in Boost.Asio
  * \tparam Addressing The addressing mode, either Unicast or Multicast
  */
 template<class Protocol, class Addressing>
-class DatagramTransport : public Transport
+class DatagramTransport : public DatagramTransportBase
 {
 public:
   using protocol = Protocol;
@@ -56,15 +122,21 @@ public:
    * \brief Construct datagram transport.
    *
    * \param socket Protocol-specific socket for the created transport
+   * \param batchSize Maximum number of datagrams received or sent in one system call;
+   *                  1 disables batched I/O
    */
   explicit
-  DatagramTransport(typename protocol::socket&& socket);
+  DatagramTransport(typename protocol::socket&& socket, size_t batchSize = 1);
+
+  ~DatagramTransport() override;
 
   ssize_t
   getSendQueueLength() override;
 
   /**
    * \brief Receive datagram, translate buffer into packet, deliver to parent class.
+   *
+   * The packet is copied out of \p buffer.
    */
   void
   receiveDatagram(span<const uint8_t> buffer, const boost::system::error_code& error);
@@ -82,6 +154,36 @@ protected:
   void
   handleReceive(const boost::system::error_code& error, size_t nBytesReceived);
 
+  /**
+   * \brief Whether outgoing packets are queued and sent with sendmmsg().
+   */
+  bool
+  isBatchSendEnabled() const noexcept
+  {
+    return m_batchSize > 1;
+  }
+
+  /**
+   * \brief Sets the socket and destination used by batched send.
+   *
+   * By default, batched send uses the receive socket without a destination address,
+   * which requires the socket to be connected.
+   */
+  void
+  setBatchSendSocket(typename protocol::socket& socket,
+                     const typename protocol::endpoint& destination)
+  {
+    m_txSocket = &socket;
+    m_txDestination = &destination;
+  }
+
+  /**
+   * \brief Queues \p packet for batched send.
+   * \pre isBatchSendEnabled()
+   */
+  void
+  enqueueSend(const Block& packet);
+
   void
   processErrorCode(const boost::system::error_code& error);
 
@@ -98,14 +200,59 @@ protected:
   NFD_LOG_MEMBER_DECL();
 
 private:
-  std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
+  void
+  startReceive();
+
+  /**
+   * \brief Receive datagram from a pooled receive buffer.
+   *
+   * The decoded packet may reference \p rxBuffer, see ReceiveBufferPool::decode().
+   */
+  void
+  receiveDatagram(const shared_ptr<ndn::Buffer>& rxBuffer, span<const uint8_t> buffer,
+                  const boost::system::error_code& error);
+
+  /**
+   * \brief Replaces \p rxBuffer with a fresh pooled buffer if decoded packets reference it.
+   * \return whether \p rxBuffer was replaced
+   */
+  static bool
+  renewReceiveBuffer(shared_ptr<ndn::Buffer>& rxBuffer);
+
+#ifdef __linux__
+  void
+  handleReadable(const boost::system::error_code& error);
+
+  void
+  flushSendQueue();
+#endif
+
+private:
+  /// pooled receive buffers, one per datagram in a batch
+  std::vector<shared_ptr<ndn::Buffer>> m_receiveBuffers;
   bool m_hasRecentlyReceived = false;
+
+#ifdef __linux__
+  std::vector<::mmsghdr> m_rxMsgs;
+  std::vector<::iovec> m_rxIovecs;
+  std::vector<::sockaddr_storage> m_rxAddrs;
+#endif
+
+  typename protocol::socket* m_txSocket = &m_socket;
+  const typename protocol::endpoint* m_txDestination = nullptr;
+  std::vector<Block> m_txQueue;
+#ifdef __linux__
+  std::vector<::mmsghdr> m_txMsgs;
+  std::vector<::iovec> m_txIovecs;
+#endif
 };
 
 
 template<class T, class U>
-DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol::socket&& socket)
-  : m_socket(std::move(socket))
+DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol::socket&& socket,
+                                           size_t batchSize)
+  : DatagramTransportBase(batchSize)
+  , m_socket(std::move(socket))
 {
   boost::asio::socket_base::send_buffer_size sendBufferSizeOption;
   boost::system::error_code error;
@@ -118,7 +265,57 @@ DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol:
     this->setSendQueueCapacity(sendBufferSizeOption.value());
   }
 
-  m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
+  m_receiveBuffers.resize(m_batchSize);
+  for (auto& rxBuffer : m_receiveBuffers) {
+    rxBuffer = getReceiveBufferPool().acquire();
+  }
+#ifdef __linux__
+  if (m_batchSize > 1) {
+    m_rxMsgs.resize(m_batchSize);
+    m_rxIovecs.resize(m_batchSize);
+    m_rxAddrs.resize(m_batchSize);
+    for (size_t i = 0; i < m_batchSize; ++i) {
+      m_rxIovecs[i].iov_base = m_receiveBuffers[i]->data();
+      m_rxIovecs[i].iov_len = m_receiveBuffers[i]->size();
+      m_rxMsgs[i].msg_hdr.msg_iov = &m_rxIovecs[i];
+      m_rxMsgs[i].msg_hdr.msg_iovlen = 1;
+      m_rxMsgs[i].msg_hdr.msg_name = &m_rxAddrs[i];
+    }
+    m_txMsgs.resize(m_batchSize);
+    m_txIovecs.resize(m_batchSize);
+    m_txQueue.reserve(m_batchSize);
+  }
+#endif
+  if (batchSize > m_batchSize) {
+    NFD_LOG_FACE_WARN("Batched datagram I/O is not supported on this platform");
+  }
+
+  startReceive();
+}
+
+template<class T, class U>
+DatagramTransport<T, U>::~DatagramTransport()
+{
+  for (auto& rxBuffer : m_receiveBuffers) {
+    getReceiveBufferPool().release(std::move(rxBuffer));
+  }
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::startReceive()
+{
+#ifdef __linux__
+  if (m_batchSize > 1) {
+    m_socket.async_wait(boost::asio::socket_base::wait_read, [this] (const auto& error) {
+      this->handleReadable(error);
+    });
+    return;
+  }
+#endif
+
+  m_socket.async_receive_from(boost::asio::buffer(*m_receiveBuffers.front()),
+                              m_sender,
                               [this] (auto&&... args) {
                                 this->handleReceive(std::forward<decltype(args)>(args)...);
                               });
@@ -162,6 +359,10 @@ DatagramTransport<T, U>::doSend(const Block& packet)
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+  if (isBatchSendEnabled()) {
+    return enqueueSend(packet);
+  }
+
   m_socket.async_send(boost::asio::buffer(packet),
                       // 'packet' is copied into the lambda to retain the underlying Buffer
                       [this, packet] (auto&&... args) {
@@ -173,13 +374,23 @@ template<class T, class U>
 void
 DatagramTransport<T, U>::receiveDatagram(span<const uint8_t> buffer,
                                          const boost::system::error_code& error)
+{
+  receiveDatagram(nullptr, buffer, error);
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::receiveDatagram(const shared_ptr<ndn::Buffer>& rxBuffer,
+                                         span<const uint8_t> buffer,
+                                         const boost::system::error_code& error)
 {
   if (error)
     return processErrorCode(error);
 
   NFD_LOG_FACE_TRACE("Received: " << buffer.size() << " bytes from " << m_sender);
 
-  auto [isOk, element] = Block::fromBuffer(buffer);
+  auto [isOk, element] = rxBuffer == nullptr ? Block::fromBuffer(buffer)
+                                             : getReceiveBufferPool().decode(rxBuffer, buffer);
   if (!isOk) {
     NFD_LOG_FACE_WARN("Failed to parse incoming packet from " << m_sender);
     // This packet won't extend the face lifetime
@@ -202,14 +413,153 @@ template<class T, class U>
 void
 DatagramTransport<T, U>::handleReceive(const boost::system::error_code& error, size_t nBytesReceived)
 {
-  receiveDatagram(ndn::make_span(m_receiveBuffer).first(nBytesReceived), error);
+  auto& rxBuffer = m_receiveBuffers.front();
+  receiveDatagram(rxBuffer, ndn::make_span(*rxBuffer).first(nBytesReceived), error);
+  renewReceiveBuffer(rxBuffer);
+
+  if (m_socket.is_open())
+    startReceive();
+}
+
+template<class T, class U>
+bool
+DatagramTransport<T, U>::renewReceiveBuffer(shared_ptr<ndn::Buffer>& rxBuffer)
+{
+  if (rxBuffer.use_count() == 1)
+    return false;
+
+  auto& pool = getReceiveBufferPool();
+  pool.release(std::move(rxBuffer));
+  rxBuffer = pool.acquire();
+  return true;
+}
+
+#ifdef __linux__
+template<class T, class U>
+void
+DatagramTransport<T, U>::handleReadable(const boost::system::error_code& error)
+{
+  if (error)
+    return processErrorCode(error);
+
+  for (auto& msg : m_rxMsgs) {
+    msg.msg_hdr.msg_namelen = sizeof(::sockaddr_storage);
+  }
+
+  int nMsgs = ::recvmmsg(m_socket.native_handle(), m_rxMsgs.data(), m_rxMsgs.size(),
+                         MSG_DONTWAIT, nullptr);
+  if (nMsgs < 0) {
+    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+      return processErrorCode(boost::system::error_code(errno, boost::system::system_category()));
+    }
+    nMsgs = 0;
+  }
+
+  if (nMsgs > 0) {
+    ++m_batchCounters.nRxBatches;
+    m_batchCounters.nRxDatagrams += nMsgs;
+    NFD_LOG_FACE_TRACE("Received batch of " << nMsgs << " datagrams");
+  }
+
+  for (int i = 0; i < nMsgs && m_socket.is_open(); ++i) {
+    const auto& hdr = m_rxMsgs[i].msg_hdr;
+    std::memcpy(m_sender.data(), hdr.msg_name, hdr.msg_namelen);
+    m_sender.resize(hdr.msg_namelen);
+    auto& rxBuffer = m_receiveBuffers[i];
+    receiveDatagram(rxBuffer, ndn::make_span(*rxBuffer).first(m_rxMsgs[i].msg_len), {});
+    if (renewReceiveBuffer(rxBuffer)) {
+      m_rxIovecs[i].iov_base = rxBuffer->data();
+    }
+  }
 
   if (m_socket.is_open())
-    m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
-                                [this] (auto&&... args) {
-                                  this->handleReceive(std::forward<decltype(args)>(args)...);
-                                });
+    startReceive();
+}
+#endif // __linux__
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::enqueueSend(const Block& packet)
+{
+  BOOST_ASSERT(isBatchSendEnabled());
+
+#ifdef __linux__
+  // 'packet' is copied into the queue to retain the underlying Buffer
+  m_txQueue.push_back(packet);
+  if (m_txQueue.size() >= m_batchSize) {
+    flushSendQueue();
+  }
+  else if (m_txQueue.size() == 1) {
+    // flush after the current handler returns, so that the packets sent by
+    // the forwarding of one incoming batch are sent together
+    boost::asio::post(getGlobalIoService(), [this] { flushSendQueue(); });
+  }
+#endif
+}
+
+#ifdef __linux__
+template<class T, class U>
+void
+DatagramTransport<T, U>::flushSendQueue()
+{
+  if (m_txQueue.empty()) {
+    return;
+  }
+  if (!m_txSocket->is_open()) {
+    m_txQueue.clear();
+    return;
+  }
+
+  size_t nMsgs = m_txQueue.size();
+  for (size_t i = 0; i < nMsgs; ++i) {
+    m_txIovecs[i].iov_base = const_cast<uint8_t*>(m_txQueue[i].data());
+    m_txIovecs[i].iov_len = m_txQueue[i].size();
+    auto& hdr = m_txMsgs[i].msg_hdr;
+    hdr = {};
+    hdr.msg_iov = &m_txIovecs[i];
+    hdr.msg_iovlen = 1;
+    if (m_txDestination != nullptr) {
+      hdr.msg_name = const_cast<void*>(static_cast<const void*>(m_txDestination->data()));
+      hdr.msg_namelen = m_txDestination->size();
+    }
+  }
+
+  size_t nSent = 0;
+  while (nSent < nMsgs) {
+    int res = ::sendmmsg(m_txSocket->native_handle(), m_txMsgs.data() + nSent, nMsgs - nSent,
+                         MSG_DONTWAIT);
+    if (res < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno != EAGAIN && errno != EWOULDBLOCK && errno != ENOBUFS) {
+        m_txQueue.clear();
+        return processErrorCode(boost::system::error_code(errno, boost::system::system_category()));
+      }
+      break;
+    }
+    ++m_batchCounters.nTxBatches;
+    m_batchCounters.nTxDatagrams += res;
+    nSent += static_cast<size_t>(res);
+  }
+  NFD_LOG_FACE_TRACE("Sent batch of " << nSent << " datagrams");
+
+  // the socket send buffer is full: send the rest asynchronously, as in unbatched mode
+  for (size_t i = nSent; i < nMsgs; ++i) {
+    const Block& packet = m_txQueue[i];
+    auto handler = [this, packet] (auto&&... args) {
+      this->handleSend(std::forward<decltype(args)>(args)...);
+    };
+    if (m_txDestination != nullptr) {
+      m_txSocket->async_send_to(boost::asio::buffer(packet), *m_txDestination, std::move(handler));
+    }
+    else {
+      m_txSocket->async_send(boost::asio::buffer(packet), std::move(handler));
+    }
+  }
+  m_txQueue.clear();
 }
+#endif // __linux__
 
 template<class T, class U>
 void
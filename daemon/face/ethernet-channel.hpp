@@ -57,9 +57,13 @@ public:
    *
    * To enable the creation of faces upon incoming connections, one needs to
    * explicitly call listen().
+   *
+   * If \p wantPacketRing is true, the unicast faces created by this channel will try
+   * to use a memory-mapped packet ring instead of libpcap (see EthernetTransport).
    */
   EthernetChannel(shared_ptr<const ndn::net::NetworkInterface> localEndpoint,
-                  time::nanoseconds idleTimeout);
+                  time::nanoseconds idleTimeout,
+                  bool wantPacketRing = false);
 
   bool
   isListening() const final
@@ -128,6 +132,7 @@ private:
   PcapHelper m_pcap;
   std::map<ethernet::Address, shared_ptr<Face>> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
+  const bool m_wantPacketRing;
 
 #ifndef NDEBUG
   /// Number of frames dropped by the kernel, as reported by libpcap
@@ -69,10 +69,21 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
   //   blacklist
   //   {
   //   }
+  //   packet_ring
+  //   {
+  //     whitelist
+  //     {
+  //       *
+  //     }
+  //     blacklist
+  //     {
+  //     }
+  //   }
   // }
 
   UnicastConfig unicastConfig;
   MulticastConfig mcastConfig;
+  PacketRingConfig packetRingConfig;
 
   if (configSection) {
     // listen and mcast default to 'yes' but only if face_system.ether section is present
@@ -113,6 +124,21 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
       else if (key == "blacklist") {
         mcastConfig.netifPredicate.parseBlacklist(value);
       }
+      else if (key == "packet_ring") {
+        packetRingConfig.isEnabled = true;
+        for (const auto& ringPair : value) {
+          if (ringPair.first == "whitelist") {
+            packetRingConfig.netifPredicate.parseWhitelist(ringPair.second);
+          }
+          else if (ringPair.first == "blacklist") {
+            packetRingConfig.netifPredicate.parseBlacklist(ringPair.second);
+          }
+          else {
+            NDN_THROW(ConfigFile::Error("Unrecognized option face_system.ether.packet_ring." +
+                                        ringPair.first));
+          }
+        }
+      }
       else {
         NDN_THROW(ConfigFile::Error("Unrecognized option face_system.ether." + key));
       }
@@ -156,10 +182,18 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
     }
   }
 
+  if (m_packetRingConfig.isEnabled != packetRingConfig.isEnabled ||
+      m_packetRingConfig.netifPredicate != packetRingConfig.netifPredicate) {
+    if (!m_channels.empty() || !m_mcastFaces.empty()) {
+      NFD_LOG_WARN("Packet ring setting applies to new Ethernet channels and faces only");
+    }
+  }
+
   // Even if there are no configuration changes, we still need to re-apply
   // the configuration because netifs may have changed.
   m_unicastConfig = std::move(unicastConfig);
   m_mcastConfig = std::move(mcastConfig);
+  m_packetRingConfig = std::move(packetRingConfig);
   applyConfig(context);
 }
 
@@ -222,7 +256,8 @@ EthernetFactory::createChannel(const shared_ptr<const ndn::net::NetworkInterface
   if (it != m_channels.end())
     return it->second;
 
-  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout);
+  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout,
+                                                   wantPacketRing(*localEndpoint));
   m_channels[localEndpoint->getName()] = channel;
   return channel;
 }
@@ -250,7 +285,8 @@ EthernetFactory::createMulticastFace(const ndn::net::NetworkInterface& netif,
   opts.allowReassembly = true;
 
   auto linkService = make_unique<GenericLinkService>(opts);
-  auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType);
+  auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType,
+                                                          wantPacketRing(netif));
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   m_mcastFaces[key] = face;
@@ -348,6 +384,12 @@ EthernetFactory::applyMcastConfigToNetif(const ndn::net::NetworkInterface& netif
   return face;
 }
 
+bool
+EthernetFactory::wantPacketRing(const ndn::net::NetworkInterface& netif) const
+{
+  return m_packetRingConfig.isEnabled && m_packetRingConfig.netifPredicate(netif);
+}
+
 void
 EthernetFactory::applyConfig(const FaceSystem::ConfigContext&)
 {
@@ -103,6 +103,12 @@ private:
   void
   applyConfig(const FaceSystem::ConfigContext& context);
 
+  /**
+   * \brief Determine whether faces on \p netif should use a memory-mapped packet ring.
+   */
+  bool
+  wantPacketRing(const ndn::net::NetworkInterface& netif) const;
+
 private:
   // ifname => channel
   std::map<std::string, shared_ptr<EthernetChannel>> m_channels;
@@ -124,6 +130,13 @@ private:
   };
   MulticastConfig m_mcastConfig;
 
+  struct PacketRingConfig
+  {
+    bool isEnabled = false;
+    NetworkInterfacePredicate netifPredicate;
+  };
+  PacketRingConfig m_packetRingConfig;
+
   // [ifname, group] => face
   std::map<std::pair<std::string, ethernet::Address>, shared_ptr<Face>> m_mcastFaces;
 
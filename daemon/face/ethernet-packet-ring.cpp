@@ -0,0 +1,314 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ethernet-packet-ring.hpp"
+
+#include "common/privilege-helper.hpp"
+
+#include <boost/endian/conversion.hpp>
+
+#include <pcap/pcap.h>
+
+#include <cerrno>
+#include <cstring>
+#include <linux/if_packet.h>
+#include <net/if.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#if !defined(PCAP_NETMASK_UNKNOWN)
+#define PCAP_NETMASK_UNKNOWN  0xffffffff
+#endif
+
+namespace nfd::face {
+
+static_assert(PacketRing::RX_BLOCK_SIZE % (1 << 12) == 0, "block size must be a multiple of the page size");
+static_assert(PacketRing::TX_FRAME_SIZE >= TPACKET3_HDRLEN + ethernet::HDR_LEN + ndn::MAX_NDN_PACKET_SIZE,
+              "transmit ring slot too small");
+
+/// offset of the frame data in a transmit ring slot, as expected by the kernel
+constexpr size_t TX_DATA_OFFSET = TPACKET3_HDRLEN - sizeof(sockaddr_ll);
+
+static std::string
+errnoString(const char* what)
+{
+  return std::string(what) + ": " + std::strerror(errno);
+}
+
+/**
+ * @brief Returns whether a received frame can be handed to the transport.
+ *
+ * VLAN-tagged frames cannot be rejected by the packet filter. By the time a socket bound to
+ * the NDN ethertype sees such a frame, the kernel has moved the tag out of the frame data, so
+ * that "not vlan" matches, and has marked the frame as addressed to another host if its VLAN
+ * ID is not zero. Truncated frames are rejected as well.
+ */
+static bool
+isFrameAcceptable(const tpacket3_hdr& frame) noexcept
+{
+  if ((frame.tp_status & TP_STATUS_VLAN_VALID) != 0 || frame.hv1.tp_vlan_tci != 0)
+    return false;
+
+  auto* sll = reinterpret_cast<const sockaddr_ll*>(reinterpret_cast<const uint8_t*>(&frame) +
+                                                   TPACKET_ALIGN(sizeof(tpacket3_hdr)));
+  if (sll->sll_pkttype == PACKET_OTHERHOST)
+    return false;
+
+  return frame.tp_snaplen >= frame.tp_len;
+}
+
+PacketRing::PacketRing(const std::string& interfaceName)
+{
+  m_ifIndex = ::if_nametoindex(interfaceName.data());
+  if (m_ifIndex == 0)
+    NDN_THROW(Error(errnoString("if_nametoindex")));
+
+  PrivilegeHelper::runElevated([this] {
+    // protocol 0: do not receive anything until the socket is bound in activate()
+    m_fd = ::socket(AF_PACKET, SOCK_RAW, 0);
+    if (m_fd < 0)
+      NDN_THROW(Error(errnoString("socket")));
+  });
+}
+
+PacketRing::~PacketRing() noexcept
+{
+  close();
+}
+
+void
+PacketRing::activate()
+{
+  int version = TPACKET_V3;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0)
+    NDN_THROW(Error(errnoString("setsockopt(PACKET_VERSION)")));
+
+  tpacket_req3 rxReq{};
+  rxReq.tp_block_size = RX_BLOCK_SIZE;
+  rxReq.tp_block_nr = RX_BLOCK_COUNT;
+  rxReq.tp_frame_size = TPACKET_ALIGNMENT << 7;
+  rxReq.tp_frame_nr = RX_BLOCK_SIZE * RX_BLOCK_COUNT / rxReq.tp_frame_size;
+  rxReq.tp_retire_blk_tov = RX_BLOCK_TIMEOUT_MS;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_RX_RING, &rxReq, sizeof(rxReq)) < 0)
+    NDN_THROW(Error(errnoString("setsockopt(PACKET_RX_RING)")));
+
+  tpacket_req3 txReq{};
+  txReq.tp_block_size = TX_FRAME_SIZE * 64;
+  txReq.tp_block_nr = TX_FRAME_COUNT / 64;
+  txReq.tp_frame_size = TX_FRAME_SIZE;
+  txReq.tp_frame_nr = TX_FRAME_COUNT;
+  if (::setsockopt(m_fd, SOL_PACKET, PACKET_TX_RING, &txReq, sizeof(txReq)) < 0)
+    NDN_THROW(Error(errnoString("setsockopt(PACKET_TX_RING)")));
+
+  m_mapSize = RX_BLOCK_SIZE * RX_BLOCK_COUNT + TX_FRAME_SIZE * TX_FRAME_COUNT;
+  void* map = ::mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_LOCKED, m_fd, 0);
+  if (map == MAP_FAILED) {
+    // MAP_LOCKED may fail due to RLIMIT_MEMLOCK, retry without it
+    map = ::mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  }
+  if (map == MAP_FAILED) {
+    m_mapSize = 0;
+    NDN_THROW(Error(errnoString("mmap")));
+  }
+  m_map = static_cast<uint8_t*>(map);
+
+  sockaddr_ll sll{};
+  sll.sll_family = AF_PACKET;
+  sll.sll_protocol = boost::endian::native_to_big(ethernet::ETHERTYPE_NDN);
+  sll.sll_ifindex = m_ifIndex;
+  if (::bind(m_fd, reinterpret_cast<sockaddr*>(&sll), sizeof(sll)) < 0)
+    NDN_THROW(Error(errnoString("bind")));
+}
+
+void
+PacketRing::close() noexcept
+{
+  if (m_map != nullptr) {
+    ::munmap(m_map, m_mapSize);
+    m_map = nullptr;
+    m_mapSize = 0;
+    m_rxBlock = nullptr;
+  }
+  if (m_fd >= 0) {
+    ::close(m_fd);
+    m_fd = -1;
+  }
+}
+
+int
+PacketRing::getFd() const
+{
+  // we need to duplicate the fd, otherwise both close() and the
+  // caller may attempt to close the same fd and one of them will fail
+  int fd = ::dup(m_fd);
+  if (fd < 0)
+    NDN_THROW(Error(errnoString("dup")));
+  return fd;
+}
+
+size_t
+PacketRing::getNDropped()
+{
+  if (m_fd < 0)
+    return m_nDropped;
+
+  // the kernel resets the statistics every time they are read
+  tpacket_stats_v3 stats{};
+  socklen_t len = sizeof(stats);
+  if (::getsockopt(m_fd, SOL_PACKET, PACKET_STATISTICS, &stats, &len) < 0)
+    NDN_THROW(Error(errnoString("getsockopt(PACKET_STATISTICS)")));
+
+  m_nDropped += stats.tp_drops;
+  return m_nDropped;
+}
+
+void
+PacketRing::setPacketFilter(const char* filter)
+{
+  pcap_t* p = pcap_open_dead(DLT_EN10MB, ethernet::HDR_LEN + ndn::MAX_NDN_PACKET_SIZE);
+  if (p == nullptr)
+    NDN_THROW(Error("pcap_open_dead failed"));
+
+  bpf_program prog;
+  if (pcap_compile(p, &prog, filter, 1, PCAP_NETMASK_UNKNOWN) < 0) {
+    std::string err = pcap_geterr(p);
+    pcap_close(p);
+    NDN_THROW(Error("pcap_compile: " + err));
+  }
+  pcap_close(p);
+
+  static_assert(sizeof(sock_filter) == sizeof(bpf_insn));
+  sock_fprog fprog{};
+  fprog.len = static_cast<unsigned short>(prog.bf_len);
+  fprog.filter = reinterpret_cast<sock_filter*>(prog.bf_insns);
+  int ret = ::setsockopt(m_fd, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog));
+  pcap_freecode(&prog);
+  if (ret < 0)
+    NDN_THROW(Error(errnoString("setsockopt(SO_ATTACH_FILTER)")));
+}
+
+tpacket_block_desc*
+PacketRing::getRxBlock(size_t index) const noexcept
+{
+  return reinterpret_cast<tpacket_block_desc*>(m_map + index * RX_BLOCK_SIZE);
+}
+
+tpacket3_hdr*
+PacketRing::getTxFrame(size_t index) const noexcept
+{
+  return reinterpret_cast<tpacket3_hdr*>(m_map + RX_BLOCK_SIZE * RX_BLOCK_COUNT +
+                                         index * TX_FRAME_SIZE);
+}
+
+void
+PacketRing::releaseRxBlock() noexcept
+{
+  __atomic_store_n(&m_rxBlock->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+  m_rxBlock = nullptr;
+  m_rxBlockIndex = (m_rxBlockIndex + 1) % RX_BLOCK_COUNT;
+}
+
+std::tuple<span<const uint8_t>, std::string>
+PacketRing::readNextPacket() noexcept
+{
+  if (m_map == nullptr)
+    return {span<uint8_t>{}, "Ring is not mapped"};
+
+  while (true) {
+    if (m_rxBlock == nullptr) {
+      auto* block = getRxBlock(m_rxBlockIndex);
+      if ((__atomic_load_n(&block->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER) == 0)
+        return {span<uint8_t>{}, "Nothing to read"};
+
+      m_rxBlock = block;
+      m_nRxFramesLeft = block->hdr.bh1.num_pkts;
+      m_rxFrame = reinterpret_cast<tpacket3_hdr*>(reinterpret_cast<uint8_t*>(block) +
+                                                  block->hdr.bh1.offset_to_first_pkt);
+    }
+
+    if (m_nRxFramesLeft > 0) {
+      auto* frame = m_rxFrame;
+      m_rxFrame = reinterpret_cast<tpacket3_hdr*>(reinterpret_cast<uint8_t*>(frame) +
+                                                  frame->tp_next_offset);
+      --m_nRxFramesLeft;
+      if (!isFrameAcceptable(*frame)) {
+        ++m_nRejected;
+        continue;
+      }
+      return {{reinterpret_cast<const uint8_t*>(frame) + frame->tp_mac, frame->tp_snaplen}, ""};
+    }
+
+    // all frames of the current block have been read, return it to the kernel
+    releaseRxBlock();
+  }
+}
+
+bool
+PacketRing::writeFrame(const ethernet::Address& dst, const ethernet::Address& src,
+                       span<const uint8_t> payload) noexcept
+{
+  size_t frameLen = ethernet::HDR_LEN + std::max<size_t>(payload.size(), ethernet::MIN_DATA_LEN);
+  if (m_map == nullptr || TX_DATA_OFFSET + frameLen > TX_FRAME_SIZE)
+    return false;
+
+  auto* hdr = getTxFrame(m_txFrameIndex);
+  if (__atomic_load_n(&hdr->tp_status, __ATOMIC_ACQUIRE) != TP_STATUS_AVAILABLE)
+    return false;
+
+  // assemble the frame in place
+  uint8_t* data = reinterpret_cast<uint8_t*>(hdr) + TX_DATA_OFFSET;
+  std::memcpy(data, dst.data(), ethernet::ADDR_LEN);
+  std::memcpy(data + ethernet::ADDR_LEN, src.data(), ethernet::ADDR_LEN);
+  uint16_t ethertype = boost::endian::native_to_big(ethernet::ETHERTYPE_NDN);
+  std::memcpy(data + 2 * ethernet::ADDR_LEN, &ethertype, ethernet::TYPE_LEN);
+  std::memcpy(data + ethernet::HDR_LEN, payload.data(), payload.size());
+  if (payload.size() < ethernet::MIN_DATA_LEN) {
+    std::memset(data + ethernet::HDR_LEN + payload.size(), 0, ethernet::MIN_DATA_LEN - payload.size());
+  }
+
+  hdr->tp_next_offset = 0;
+  hdr->tp_len = static_cast<uint32_t>(frameLen);
+  __atomic_store_n(&hdr->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+
+  m_txFrameIndex = (m_txFrameIndex + 1) % TX_FRAME_COUNT;
+  ++m_nTxPending;
+  return true;
+}
+
+std::string
+PacketRing::flush() noexcept
+{
+  if (m_nTxPending == 0)
+    return "";
+
+  m_nTxPending = 0;
+  // a zero-length send() makes the kernel transmit all slots marked TP_STATUS_SEND_REQUEST
+  if (::send(m_fd, nullptr, 0, MSG_DONTWAIT) < 0 && errno != EAGAIN && errno != ENOBUFS)
+    return errnoString("send");
+  return "";
+}
+
+} // namespace nfd::face
@@ -0,0 +1,213 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
+#define NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
+
+#include "ethernet-protocol.hpp"
+
+#ifndef __linux__
+#error "Cannot include this file on platforms other than Linux"
+#endif
+
+// forward declarations
+struct tpacket_block_desc;
+struct tpacket3_hdr;
+
+namespace nfd::face {
+
+/**
+ * @brief Memory-mapped `AF_PACKET` socket with `TPACKET_V3` receive and transmit rings.
+ *
+ * This is an alternative to PcapHelper for Ethernet transports on Linux. The socket is bound
+ * to the NDN ethertype, so that the kernel only queues NDN frames, and additional filtering
+ * (e.g., on the source and destination addresses) is done by a classic BPF program attached
+ * to the socket. Received frames are read directly from the shared receive ring, and
+ * outgoing frames are written directly into the transmit ring, with the Ethernet header and
+ * the payload assembled in place.
+ *
+ * The kernel hands over a receive block to user space when the block is full, or after a
+ * short timeout (see RX_BLOCK_TIMEOUT_MS), so that a single wakeup can deliver many frames.
+ * Frames written into the transmit ring are sent by the next call to flush().
+ */
+class PacketRing : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @brief Creates an `AF_PACKET` socket for the given network interface.
+   * @throw Error on any error
+   */
+  explicit
+  PacketRing(const std::string& interfaceName);
+
+  ~PacketRing() noexcept;
+
+  /**
+   * @brief Sets up and maps the rings, and binds the socket to the interface.
+   * @throw Error on any error
+   */
+  void
+  activate();
+
+  /**
+   * @brief Unmaps the rings and closes the socket.
+   */
+  void
+  close() noexcept;
+
+  bool
+  isOpen() const noexcept
+  {
+    return m_fd >= 0;
+  }
+
+  /**
+   * @brief Obtain a file descriptor that can be used in calls such as select(2) and poll(2).
+   * @pre activate() has been called.
+   * @return A selectable file descriptor. It is the caller's responsibility to close the fd.
+   * @throw Error on any error
+   */
+  int
+  getFd() const;
+
+  /**
+   * @brief Get the number of frames dropped by the kernel since activate() was called.
+   * @throw Error on any error
+   */
+  size_t
+  getNDropped();
+
+  /**
+   * @brief Get the number of received frames that were discarded by readNextPacket()
+   *        because they were VLAN-tagged or truncated.
+   */
+  size_t
+  getNRejected() const noexcept
+  {
+    return m_nRejected;
+  }
+
+  /**
+   * @brief Install a BPF filter on the socket.
+   * @param filter Null-terminated string containing the filter expression, in the syntax
+   *               described by pcap-filter(7); it is compiled with libpcap.
+   * @pre activate() has been called.
+   * @throw Error on any error
+   */
+  void
+  setPacketFilter(const char* filter);
+
+  /**
+   * @brief Read the next frame from the receive ring.
+   *
+   * VLAN-tagged and truncated frames are skipped, see getNRejected().
+   *
+   * @return If successful, returns a tuple containing a read-only view of the received
+   *         frame bytes (including the link-layer header) and a second element that
+   *         must be ignored. Otherwise, returns a tuple containing an empty span and
+   *         the reason why no frame was returned.
+   * @warning The returned span is valid only until the next call to this function.
+   */
+  std::tuple<span<const uint8_t>, std::string>
+  readNextPacket() noexcept;
+
+  /**
+   * @brief Write an Ethernet frame into the transmit ring.
+   *
+   * The payload is padded with zeroes to the minimum Ethernet frame size.
+   * The frame is not sent until flush() is called.
+   *
+   * @return whether the frame was written; false if the transmit ring is full
+   *         or the frame is too large for a ring slot
+   */
+  bool
+  writeFrame(const ethernet::Address& dst, const ethernet::Address& src,
+             span<const uint8_t> payload) noexcept;
+
+  /**
+   * @brief Ask the kernel to send all frames written into the transmit ring.
+   * @return empty string on success, otherwise the reason for the failure
+   */
+  std::string
+  flush() noexcept;
+
+  /**
+   * @brief Returns whether frames have been written since the last flush().
+   */
+  bool
+  hasPendingFrames() const noexcept
+  {
+    return m_nTxPending > 0;
+  }
+
+public:
+  /// size of a receive block
+  static constexpr size_t RX_BLOCK_SIZE = 1 << 20;
+  /// number of receive blocks
+  static constexpr size_t RX_BLOCK_COUNT = 4;
+  /// maximum time before a partially filled receive block is handed over to user space
+  static constexpr unsigned int RX_BLOCK_TIMEOUT_MS = 1;
+  /// size of a transmit ring slot; must hold a tpacket3_hdr and a full-size frame
+  static constexpr size_t TX_FRAME_SIZE = 1 << 14;
+  /// number of transmit ring slots
+  static constexpr size_t TX_FRAME_COUNT = 128;
+
+private:
+  tpacket_block_desc*
+  getRxBlock(size_t index) const noexcept;
+
+  tpacket3_hdr*
+  getTxFrame(size_t index) const noexcept;
+
+  void
+  releaseRxBlock() noexcept;
+
+private:
+  int m_fd = -1;
+  int m_ifIndex = 0;
+  uint8_t* m_map = nullptr;
+  size_t m_mapSize = 0;
+
+  size_t m_rxBlockIndex = 0;
+  tpacket_block_desc* m_rxBlock = nullptr; ///< block being read, if any
+  tpacket3_hdr* m_rxFrame = nullptr;       ///< next frame to read in m_rxBlock
+  uint32_t m_nRxFramesLeft = 0;
+
+  size_t m_txFrameIndex = 0;
+  size_t m_nTxPending = 0;
+
+  size_t m_nDropped = 0;
+  size_t m_nRejected = 0;
+};
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
@@ -32,6 +32,7 @@
 #include <array>
 
 #include <boost/asio/defer.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/endian/conversion.hpp>
 
 namespace nfd::face {
@@ -39,19 +40,39 @@ namespace nfd::face {
 NFD_LOG_INIT(EthernetTransport);
 
 EthernetTransport::EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
-                                     const ethernet::Address& remoteEndpoint)
+                                     const ethernet::Address& remoteEndpoint,
+                                     bool wantPacketRing)
   : m_socket(getGlobalIoService())
   , m_pcap(localEndpoint.getName())
   , m_srcAddress(localEndpoint.getEthernetAddress())
   , m_destAddress(remoteEndpoint)
   , m_interfaceName(localEndpoint.getName())
 {
-  try {
-    m_pcap.activate(DLT_EN10MB);
-    m_socket.assign(m_pcap.getFd());
+  if (wantPacketRing) {
+#ifdef __linux__
+    try {
+      auto ring = make_unique<PacketRing>(m_interfaceName);
+      ring->activate();
+      m_socket.assign(ring->getFd());
+      m_ring = std::move(ring);
+    }
+    catch (const PacketRing::Error& e) {
+      NFD_LOG_WARN("[" << m_interfaceName << "] Cannot use packet ring, falling back to libpcap: " <<
+                   e.what());
+    }
+#else
+    NFD_LOG_WARN("[" << m_interfaceName << "] Packet ring is not supported on this platform");
+#endif
   }
-  catch (const PcapHelper::Error& e) {
-    NDN_THROW_NESTED(Error(e.what()));
+
+  if (!usesPacketRing()) {
+    try {
+      m_pcap.activate(DLT_EN10MB);
+      m_socket.assign(m_pcap.getFd());
+    }
+    catch (const PcapHelper::Error& e) {
+      NDN_THROW_NESTED(Error(e.what()));
+    }
   }
 
   // Set initial transport state based upon the state of the underlying NetworkInterface
@@ -83,6 +104,11 @@ EthernetTransport::doClose()
     m_socket.close(error);
   }
   m_pcap.close();
+#ifdef __linux__
+  if (m_ring != nullptr) {
+    m_ring->close();
+  }
+#endif
 
   // Ensure that the Transport stays alive at least
   // until all pending handlers are dispatched
@@ -91,6 +117,17 @@ EthernetTransport::doClose()
   });
 }
 
+void
+EthernetTransport::setPacketFilter(const char* filter)
+{
+#ifdef __linux__
+  if (m_ring != nullptr) {
+    return m_ring->setPacketFilter(filter);
+  }
+#endif
+  m_pcap.setPacketFilter(filter);
+}
+
 void
 EthernetTransport::handleNetifStateChange(ndn::net::InterfaceState netifState)
 {
@@ -116,6 +153,27 @@ EthernetTransport::doSend(const Block& packet)
 void
 EthernetTransport::sendPacket(const ndn::Block& block)
 {
+#ifdef __linux__
+  if (m_ring != nullptr) {
+    // the frame is assembled directly in the transmit ring
+    if (!m_ring->writeFrame(m_destAddress, m_srcAddress, {block.data(), block.size()})) {
+      // the ring is full: ask the kernel to send the pending frames, and retry once
+      flushPacketRing();
+      if (!m_ring->writeFrame(m_destAddress, m_srcAddress, {block.data(), block.size()})) {
+        NFD_LOG_FACE_DEBUG("Transmit ring is full, dropping " << block.size() << " bytes");
+        return;
+      }
+    }
+    // send all frames written by the current handler with a single system call
+    if (!m_isFlushPending) {
+      m_isFlushPending = true;
+      boost::asio::post(getGlobalIoService(), [this] { flushPacketRing(); });
+    }
+    NFD_LOG_FACE_TRACE("Queued for sending: " << block.size() << " bytes");
+    return;
+  }
+#endif
+
   ndn::EncodingBuffer buffer(block);
 
   // pad with zeroes if the payload is too short
@@ -164,25 +222,34 @@ EthernetTransport::handleRead(const boost::system::error_code& error)
     return;
   }
 
-  auto [pkt, readErr] = m_pcap.readNextPacket();
-  if (pkt.empty()) {
-    NFD_LOG_FACE_DEBUG("Read error: " << readErr);
+#ifdef __linux__
+  if (m_ring != nullptr) {
+    // drain all frames that are ready in the receive ring
+    while (m_ring->isOpen()) {
+      auto [pkt, readErr] = m_ring->readNextPacket();
+      if (pkt.empty())
+        break;
+      processFrame(pkt);
+    }
   }
-  else {
-    auto [eh, frameErr] = ethernet::checkFrameHeader(pkt, m_srcAddress,
-                                                     m_destAddress.isMulticast() ? m_destAddress : m_srcAddress);
-    if (eh == nullptr) {
-      NFD_LOG_FACE_WARN(frameErr);
+  else
+#endif
+  {
+    auto [pkt, readErr] = m_pcap.readNextPacket();
+    if (pkt.empty()) {
+      NFD_LOG_FACE_DEBUG("Read error: " << readErr);
     }
     else {
-      ethernet::Address sender(eh->ether_shost);
-      pkt = pkt.subspan(ethernet::HDR_LEN);
-      receivePayload(pkt, sender);
+      processFrame(pkt);
     }
   }
 
 #ifndef NDEBUG
+#ifdef __linux__
+  size_t nDropped = m_ring != nullptr ? m_ring->getNDropped() : m_pcap.getNDropped();
+#else
   size_t nDropped = m_pcap.getNDropped();
+#endif
   if (nDropped - m_nDropped > 0)
     NFD_LOG_FACE_DEBUG("Detected " << nDropped - m_nDropped << " dropped frame(s)");
   m_nDropped = nDropped;
@@ -191,6 +258,34 @@ EthernetTransport::handleRead(const boost::system::error_code& error)
   asyncRead();
 }
 
+void
+EthernetTransport::processFrame(span<const uint8_t> frame)
+{
+  auto [eh, frameErr] = ethernet::checkFrameHeader(frame, m_srcAddress,
+                                                   m_destAddress.isMulticast() ? m_destAddress : m_srcAddress);
+  if (eh == nullptr) {
+    NFD_LOG_FACE_WARN(frameErr);
+    return;
+  }
+
+  ethernet::Address sender(eh->ether_shost);
+  receivePayload(frame.subspan(ethernet::HDR_LEN), sender);
+}
+
+#ifdef __linux__
+void
+EthernetTransport::flushPacketRing()
+{
+  m_isFlushPending = false;
+  if (m_ring == nullptr || !m_ring->isOpen() || !m_ring->hasPendingFrames())
+    return;
+
+  std::string err = m_ring->flush();
+  if (!err.empty())
+    handleError("Send operation failed: " + err);
+}
+#endif
+
 void
 EthernetTransport::receivePayload(span<const uint8_t> payload, const ethernet::Address& sender)
 {
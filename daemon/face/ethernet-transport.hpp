@@ -30,6 +30,10 @@
 #include "pcap-helper.hpp"
 #include "transport.hpp"
 
+#ifdef __linux__
+#include "ethernet-packet-ring.hpp"
+#endif
+
 #include <boost/asio/posix/stream_descriptor.hpp>
 #include <ndn-cxx/net/network-interface.hpp>
 
@@ -55,13 +59,39 @@ public:
   void
   receivePayload(span<const uint8_t> payload, const ethernet::Address& sender);
 
+  /**
+   * @brief Returns whether frames are sent and received through a PacketRing instead of libpcap.
+   */
+  bool
+  usesPacketRing() const noexcept
+  {
+#ifdef __linux__
+    return m_ring != nullptr;
+#else
+    return false;
+#endif
+  }
+
 protected:
+  /**
+   * @param localEndpoint the network interface
+   * @param remoteEndpoint the remote Ethernet address
+   * @param wantPacketRing use a memory-mapped PacketRing if supported, otherwise libpcap
+   */
   EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
-                    const ethernet::Address& remoteEndpoint);
+                    const ethernet::Address& remoteEndpoint,
+                    bool wantPacketRing = false);
 
   void
   doClose() final;
 
+  /**
+   * @brief Install a BPF filter on the receiving socket.
+   * @param filter Null-terminated string containing the filter expression, see pcap-filter(7).
+   */
+  void
+  setPacketFilter(const char* filter);
+
   bool
   hasRecentlyReceived() const
   {
@@ -93,6 +123,17 @@ private:
   void
   handleRead(const boost::system::error_code& error);
 
+  /**
+   * @brief Checks the Ethernet header of a received frame and processes its payload.
+   */
+  void
+  processFrame(span<const uint8_t> frame);
+
+#ifdef __linux__
+  void
+  flushPacketRing();
+#endif
+
   void
   handleError(const std::string& errorMessage);
 
@@ -104,11 +145,15 @@ protected:
   std::string m_interfaceName;
 
 private:
+#ifdef __linux__
+  unique_ptr<PacketRing> m_ring;
+  bool m_isFlushPending = false;
+#endif
   signal::ScopedConnection m_netifStateChangedConn;
   signal::ScopedConnection m_netifMtuChangedConn;
   bool m_hasRecentlyReceived = false;
 #ifndef NDEBUG
-  /// Number of frames dropped by the kernel, as reported by libpcap
+  /// Number of frames dropped by the kernel, as reported by libpcap or the PacketRing
   size_t m_nDropped = 0;
 #endif
 };
@@ -46,6 +46,8 @@ GenericLinkService::GenericLinkService(const GenericLinkService::Options& option
   , m_reliability(m_options.reliabilityOptions, this)
 {
   m_reassembler.beforeTimeout.connect([this] (auto&&...) { ++nReassemblyTimeouts; });
+  m_reassembler.beforeEviction.connect([this] (auto&&...) { ++nReassemblyEvictions; });
+  m_reassembler.onQuotaExceeded.connect([this] (auto&&...) { ++nReassemblyQuotaDrops; });
   m_reliability.onDroppedInterest.connect([this] (const auto& i) { notifyDroppedInterest(i); });
   nReassembling.observe(&m_reassembler);
 }
@@ -112,7 +114,14 @@ GenericLinkService::sendLpPacket(lp::Packet&& pkt)
 void
 GenericLinkService::doSendInterest(const Interest& interest)
 {
-  lp::Packet lpPacket(interest.wireEncode());
+  const Block& wire = interest.wireEncode();
+  if (canBypassLp(interest, wire)) {
+    ++nOutLpBypassed;
+    this->sendPacket(wire);
+    return;
+  }
+
+  lp::Packet lpPacket(wire);
 
   encodeLpFields(interest, lpPacket);
 
@@ -122,7 +131,14 @@ GenericLinkService::doSendInterest(const Interest& interest)
 void
 GenericLinkService::doSendData(const Data& data)
 {
-  lp::Packet lpPacket(data.wireEncode());
+  const Block& wire = data.wireEncode();
+  if (canBypassLp(data, wire)) {
+    ++nOutLpBypassed;
+    this->sendPacket(wire);
+    return;
+  }
+
+  lp::Packet lpPacket(wire);
 
   encodeLpFields(data, lpPacket);
 
@@ -148,6 +164,45 @@ GenericLinkService::assignSequences(std::vector<lp::Packet>& pkts)
   });
 }
 
+bool
+GenericLinkService::canBypassLp(const ndn::PacketBase& netPkt, const Block& wire)
+{
+  // reliability needs a Sequence on every packet and piggybacks Acks
+  if (m_options.reliabilityOptions.isEnabled) {
+    return false;
+  }
+
+  // the packet must fit in the MTU, otherwise it must be fragmented or dropped
+  ssize_t mtu = getEffectiveMtu();
+  if (mtu != MTU_UNLIMITED && wire.size() > static_cast<size_t>(mtu)) {
+    return false;
+  }
+
+  // same tags as in encodeLpFields
+  if (netPkt.getTag<lp::CongestionMarkTag>() != nullptr ||
+      netPkt.getTag<lp::PitToken>() != nullptr) {
+    return false;
+  }
+  if (m_options.allowLocalFields && netPkt.getTag<lp::IncomingFaceIdTag>() != nullptr) {
+    return false;
+  }
+  if (m_options.allowSelfLearning &&
+      (netPkt.getTag<lp::NonDiscoveryTag>() != nullptr ||
+       netPkt.getTag<lp::PrefixAnnouncementTag>() != nullptr)) {
+    return false;
+  }
+
+  // the packet may have to carry a congestion mark; this is decided by checkCongestionLevel,
+  // which does nothing if the send queue is below target outside of a congestion incident
+  if (m_options.allowCongestionMarking &&
+      (m_nextMarkTime != time::steady_clock::time_point::max() ||
+       isSendQueueAboveTarget().value_or(false))) {
+    return false;
+  }
+
+  return true;
+}
+
 void
 GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket)
 {
@@ -239,23 +294,40 @@ GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest)
   }
 }
 
-void
-GenericLinkService::checkCongestionLevel(lp::Packet& pkt)
+std::optional<bool>
+GenericLinkService::isSendQueueAboveTarget()
 {
   ssize_t sendQueueLength = getTransport()->getSendQueueLength();
   // The transport must support retrieving the current send queue length
   if (sendQueueLength < 0) {
-    return;
+    return std::nullopt;
   }
 
+  time::nanoseconds sojournTime = getTransport()->getSendQueueSojournTime();
+  time::nanoseconds target = m_options.baseCongestionMarkingInterval /
+                             std::max(m_options.congestionTargetRatio, 1U);
+
   if (sendQueueLength > 0) {
     NFD_LOG_FACE_TRACE("txqlen=" << sendQueueLength << " threshold=" <<
                        m_options.defaultCongestionThreshold << " capacity=" <<
-                       getTransport()->getSendQueueCapacity());
+                       getTransport()->getSendQueueCapacity() << " sojourn=" <<
+                       sojournTime << " target=" << target);
+  }
+
+  return static_cast<size_t>(sendQueueLength) > m_options.defaultCongestionThreshold ||
+         sojournTime > target;
+}
+
+void
+GenericLinkService::checkCongestionLevel(lp::Packet& pkt)
+{
+  auto isAboveTarget = isSendQueueAboveTarget();
+  if (!isAboveTarget) {
+    return;
   }
 
   // sendQueue is above target
-  if (static_cast<size_t>(sendQueueLength) > m_options.defaultCongestionThreshold) {
+  if (*isAboveTarget) {
     const auto now = time::steady_clock::now();
 
     if (m_nextMarkTime == time::steady_clock::time_point::max()) {
@@ -278,7 +350,7 @@ GenericLinkService::checkCongestionLevel(lp::Packet& pkt)
   }
   else if (m_nextMarkTime != time::steady_clock::time_point::max()) {
     // Congestion incident has ended, so reset
-    NFD_LOG_FACE_DEBUG("Send queue length dropped below congestion threshold");
+    NFD_LOG_FACE_DEBUG("Send queue dropped below congestion target");
     m_nextMarkTime = time::steady_clock::time_point::max();
     m_nMarkedSinceInMarkingState = 0;
   }
@@ -287,6 +359,14 @@ GenericLinkService::checkCongestionLevel(lp::Packet& pkt)
 void
 GenericLinkService::doReceivePacket(const Block& packet, const EndpointId& endpoint)
 {
+  // a bare Interest or Data carries no link protocol fields and is never a fragment
+  if (packet.type() == tlv::Interest || packet.type() == tlv::Data) {
+    static const lp::Packet noLpFields;
+    ++nInLpBypassed;
+    this->decodeNetPacket(packet, noLpFields, endpoint);
+    return;
+  }
+
   try {
     lp::Packet pkt(packet);
 
@@ -62,6 +62,15 @@ public:
   /// Count of dropped partial network-layer packets due to reassembly timeout.
   PacketCounter nReassemblyTimeouts;
 
+  /// Count of partial network-layer packets evicted because the reassembly buffer was full.
+  PacketCounter nReassemblyEvictions;
+
+  /**
+   * \brief Count of fragments dropped because the sender exceeded its reassembly quota,
+   *        or the reassembly buffer could not make room for them.
+   */
+  PacketCounter nReassemblyQuotaDrops;
+
   /// Count of invalid reassembled network-layer packets dropped.
   PacketCounter nInNetInvalid;
 
@@ -85,6 +94,18 @@ public:
 
   /// Count of outgoing LpPackets that were marked with congestion marks.
   PacketCounter nCongestionMarked;
+
+  /**
+   * \brief Count of outgoing Interests and Data sent as bare network-layer packets
+   *        without going through NDNLPv2 encoding.
+   */
+  PacketCounter nOutLpBypassed;
+
+  /**
+   * \brief Count of incoming bare Interests and Data delivered without going through
+   *        NDNLPv2 decoding.
+   */
+  PacketCounter nInLpBypassed;
 };
 
 /**
@@ -126,10 +147,21 @@ struct GenericLinkServiceOptions
    *
    *  Packets are marked if the queue size stays above THRESHOLD for at least one INTERVAL.
    *
+   *  If the transport reports the sojourn time of its send queue, packets are also marked if
+   *  the sojourn time stays above TARGET for at least one INTERVAL. TARGET is derived from
+   *  INTERVAL, see congestionTargetRatio.
+   *
    *  The default value (100 ms) is taken from RFC 8289 (CoDel).
    */
   time::nanoseconds baseCongestionMarkingInterval = 100_ms;
 
+  /** \brief Ratio of congestion marking interval to the send queue sojourn time target.
+   *
+   *  The default value (20) gives a TARGET of 5 ms with the default INTERVAL,
+   *  as recommended by RFC 8289 (CoDel).
+   */
+  unsigned int congestionTargetRatio = 20;
+
   /** \brief Default congestion threshold in bytes.
    *
    *  Packets are marked if the queue size stays above THRESHOLD for at least one INTERVAL.
@@ -231,6 +263,16 @@ NFD_PROTECTED_WITH_TESTS_ELSE_PRIVATE: // send path
   assignSequences(std::vector<lp::Packet>& pkts);
 
 private: // send path
+  /** \brief Determine whether a network-layer packet can be sent without NDNLPv2 encoding.
+   *  \param netPkt network-layer packet to extract tags from
+   *  \param wire encoded \p netPkt
+   *
+   *  This is the case if no link protocol field would be added to the packet, and
+   *  the packet needs neither fragmentation nor reliability.
+   */
+  bool
+  canBypassLp(const ndn::PacketBase& netPkt, const Block& wire);
+
   /** \brief Encode link protocol fields from tags onto an outgoing LpPacket.
    *  \param netPkt network-layer packet to extract tags from
    *  \param lpPacket LpPacket to add link protocol fields to
@@ -245,6 +287,17 @@ private: // send path
   void
   sendNetPacket(lp::Packet&& pkt, bool isInterest);
 
+  /** \brief Returns whether the send queue is above the congestion target.
+   *
+   *  The send queue is above target if its length exceeds the congestion threshold, or if
+   *  the transport reports a sojourn time that exceeds the target derived from the
+   *  congestion marking interval.
+   *
+   *  \retval std::nullopt the transport does not support queue length retrieval
+   */
+  std::optional<bool>
+  isSendQueueAboveTarget();
+
   /** \brief If the send queue is found to be congested, add a congestion mark to the packet
    *         according to CoDel.
    *  \sa https://tools.ietf.org/html/rfc8289
@@ -30,6 +30,7 @@
 #include <ndn-cxx/lp/fields.hpp>
 
 #include <numeric>
+#include <string_view>
 
 namespace nfd::face {
 
@@ -82,47 +83,77 @@ LpReassembler::receiveFragment(const EndpointId& remoteEndpoint, const lp::Packe
   lp::Sequence messageIdentifier = packet.get<lp::SequenceField>() - fragIndex;
   Key key(remoteEndpoint, messageIdentifier);
 
+  // octets accounted to this fragment, plus the fragment table if this starts a new PartialPacket
+  auto [fragBegin, fragEnd] = packet.get<lp::FragmentField>();
+  size_t nBytes = static_cast<size_t>(std::distance(fragBegin, fragEnd));
+  auto ppIt = m_partialPackets.find(key);
+  if (ppIt == m_partialPackets.end()) {
+    nBytes += fragCount * sizeof(lp::Packet);
+  }
+  else if (fragCount != ppIt->second.fragCount) {
+    NFD_LOG_FACE_WARN("reassembly error, FragCount changed: DROP");
+    return {false, {}, {}};
+  }
+  else if (ppIt->second.fragments[fragIndex].has<lp::SequenceField>()) {
+    NFD_LOG_FACE_TRACE("fragment already received: DROP");
+    return {false, {}, {}};
+  }
+
+  // enforce per-endpoint quota and global limit
+  auto epIt = m_endpointBytes.find(remoteEndpoint);
+  size_t nEndpointBytes = epIt == m_endpointBytes.end() ? 0 : epIt->second;
+  if (nEndpointBytes + nBytes > m_options.maxEndpointBytes) {
+    NFD_LOG_FACE_DEBUG("reassembly quota exceeded for remote endpoint: DROP");
+    this->onQuotaExceeded(remoteEndpoint);
+    return {false, {}, {}};
+  }
+  if (!makeRoom(nBytes, key)) {
+    NFD_LOG_FACE_DEBUG("reassembly buffer full: DROP");
+    this->onQuotaExceeded(remoteEndpoint);
+    return {false, {}, {}};
+  }
+
   // add to PartialPacket
-  PartialPacket& pp = m_partialPackets[key];
-  if (pp.fragCount == 0) { // new PartialPacket
+  auto expiry = time::steady_clock::now() + m_options.reassemblyTimeout;
+  if (ppIt == m_partialPackets.end()) { // new PartialPacket
+    ppIt = m_partialPackets.try_emplace(key).first;
+    PartialPacket& pp = ppIt->second;
     pp.fragCount = fragCount;
     pp.nReceivedFragments = 0;
+    pp.nBytes = 0;
     pp.fragments.resize(fragCount);
+    pp.expiryIt = m_expiryQueue.insert(m_expiryQueue.end(), ExpiryEntry{key, expiry});
   }
   else {
-    if (fragCount != pp.fragCount) {
-      NFD_LOG_FACE_WARN("reassembly error, FragCount changed: DROP");
-      return {false, {}, {}};
-    }
-  }
-
-  if (pp.fragments[fragIndex].has<lp::SequenceField>()) {
-    NFD_LOG_FACE_TRACE("fragment already received: DROP");
-    return {false, {}, {}};
+    // reset drop timer by moving to the back of the expiry queue
+    PartialPacket& pp = ppIt->second;
+    m_expiryQueue.splice(m_expiryQueue.end(), m_expiryQueue, pp.expiryIt);
+    pp.expiryIt->expiry = expiry;
   }
 
+  PartialPacket& pp = ppIt->second;
   pp.fragments[fragIndex] = packet;
   ++pp.nReceivedFragments;
+  pp.nBytes += nBytes;
+  m_endpointBytes[remoteEndpoint] += nBytes;
+  m_nBufferedBytes += nBytes;
 
   // check complete condition
   if (pp.nReceivedFragments == pp.fragCount) {
-    Block reassembled = doReassembly(key);
+    Block reassembled = doReassembly(pp);
     lp::Packet firstFrag(std::move(pp.fragments[0]));
-    m_partialPackets.erase(key);
+    erasePartialPacket(ppIt);
     return {true, reassembled, firstFrag};
   }
 
-  // set drop timer
-  pp.dropTimer = getScheduler().schedule(m_options.reassemblyTimeout, [=] { timeoutPartialPacket(key); });
+  scheduleExpiry();
 
   return {false, {}, {}};
 }
 
 Block
-LpReassembler::doReassembly(const Key& key)
+LpReassembler::doReassembly(const PartialPacket& pp)
 {
-  PartialPacket& pp = m_partialPackets[key];
-
   size_t payloadSize = std::accumulate(pp.fragments.begin(), pp.fragments.end(), 0U,
     [&] (size_t sum, const lp::Packet& pkt) -> size_t {
       auto [fragBegin, fragEnd] = pkt.get<lp::FragmentField>();
@@ -138,18 +169,99 @@ LpReassembler::doReassembly(const Key& key)
   return Block(fragBuffer);
 }
 
+bool
+LpReassembler::makeRoom(size_t nBytes, const Key& key)
+{
+  // the expiry queue is ordered by most recent activity, so the front is the stalest;
+  // the partial packet receiving this fragment is skipped, not evicted
+  auto qIt = m_expiryQueue.begin();
+  while (m_nBufferedBytes + nBytes > m_options.maxBufferedBytes && qIt != m_expiryQueue.end()) {
+    if (qIt->key == key) {
+      ++qIt;
+      continue;
+    }
+    auto it = m_partialPackets.find(qIt->key);
+    BOOST_ASSERT(it != m_partialPackets.end());
+    ++qIt; // erasePartialPacket() removes the current element from the expiry queue
+    NFD_LOG_FACE_DEBUG("reassembly buffer full, evicting partial packet with " <<
+                       it->second.nReceivedFragments << " fragments");
+    this->beforeEviction(std::get<0>(it->first), it->second.nReceivedFragments);
+    erasePartialPacket(it);
+  }
+
+  return m_nBufferedBytes + nBytes <= m_options.maxBufferedBytes;
+}
+
 void
-LpReassembler::timeoutPartialPacket(const Key& key)
+LpReassembler::erasePartialPacket(PartialPacketMap::iterator it)
 {
-  auto it = m_partialPackets.find(key);
-  if (it == m_partialPackets.end()) {
-    return;
+  const PartialPacket& pp = it->second;
+
+  auto epIt = m_endpointBytes.find(std::get<0>(it->first));
+  BOOST_ASSERT(epIt != m_endpointBytes.end() && epIt->second >= pp.nBytes);
+  epIt->second -= pp.nBytes;
+  if (epIt->second == 0) {
+    m_endpointBytes.erase(epIt);
   }
 
-  this->beforeTimeout(std::get<0>(key), it->second.nReceivedFragments);
+  BOOST_ASSERT(m_nBufferedBytes >= pp.nBytes);
+  m_nBufferedBytes -= pp.nBytes;
+
+  m_expiryQueue.erase(pp.expiryIt);
   m_partialPackets.erase(it);
 }
 
+void
+LpReassembler::scheduleExpiry()
+{
+  if (m_expiryTimer || m_expiryQueue.empty()) {
+    return;
+  }
+
+  auto delay = m_expiryQueue.front().expiry - time::steady_clock::now();
+  m_expiryTimer = getScheduler().schedule(delay, [this] { expirePartialPackets(); });
+}
+
+void
+LpReassembler::expirePartialPackets()
+{
+  auto now = time::steady_clock::now();
+
+  while (!m_expiryQueue.empty() && m_expiryQueue.front().expiry <= now) {
+    auto it = m_partialPackets.find(m_expiryQueue.front().key);
+    BOOST_ASSERT(it != m_partialPackets.end());
+    this->beforeTimeout(std::get<0>(it->first), it->second.nReceivedFragments);
+    erasePartialPacket(it);
+  }
+
+  scheduleExpiry();
+}
+
+size_t
+LpReassembler::EndpointIdHash::operator()(const EndpointId& ep) const noexcept
+{
+  return std::visit([] (const auto& addr) -> size_t {
+    using T = std::decay_t<decltype(addr)>;
+    if constexpr (std::is_same_v<T, ethernet::Address>) {
+      return std::hash<std::string_view>{}({reinterpret_cast<const char*>(addr.data()), addr.size()});
+    }
+    else if constexpr (std::is_same_v<T, udp::Endpoint>) {
+      return udp::EndpointHash{}(addr);
+    }
+    else {
+      return 0;
+    }
+  }, ep);
+}
+
+size_t
+LpReassembler::KeyHash::operator()(const Key& key) const noexcept
+{
+  size_t h = EndpointIdHash{}(std::get<0>(key));
+  h ^= std::hash<lp::Sequence>{}(std::get<1>(key)) + 0x9E3779B9 + (h << 6) + (h >> 2);
+  return h;
+}
+
 std::ostream&
 operator<<(std::ostream& os, const FaceLogHelper<LpReassembler>& flh)
 {
@@ -32,7 +32,8 @@
 #include <ndn-cxx/lp/sequence.hpp>
 #include <ndn-cxx/util/scheduler.hpp>
 
-#include <map>
+#include <list>
+#include <unordered_map>
 
 namespace nfd::face {
 
@@ -59,6 +60,21 @@ public:
      * \brief Timeout before a partially reassembled packet is dropped.
      */
     time::nanoseconds reassemblyTimeout = 500_ms;
+
+    /**
+     * \brief Maximum number of octets buffered for all partial packets.
+     *
+     * When this limit is reached, the least recently active partial packets are evicted
+     * to make room for new fragments.
+     */
+    size_t maxBufferedBytes = 4 * 1024 * 1024;
+
+    /**
+     * \brief Maximum number of octets buffered for partial packets from one remote endpoint.
+     *
+     * Fragments that would exceed this quota are dropped.
+     */
+    size_t maxEndpointBytes = 1024 * 1024;
   };
 
   explicit
@@ -116,7 +132,60 @@ public:
    */
   signal::Signal<LpReassembler, EndpointId, size_t> beforeTimeout;
 
+  /**
+   * \brief Notifies before a partial packet is evicted due to Options::maxBufferedBytes.
+   *
+   * This signal is emitted with the remote endpoint and the number of fragments being dropped.
+   */
+  signal::Signal<LpReassembler, EndpointId, size_t> beforeEviction;
+
+  /**
+   * \brief Notifies when a fragment is dropped because buffering it would exceed
+   *        Options::maxEndpointBytes or Options::maxBufferedBytes.
+   */
+  signal::Signal<LpReassembler, EndpointId> onQuotaExceeded;
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /**
+   * \brief Returns the number of octets currently buffered for all partial packets.
+   */
+  size_t
+  getBufferedBytes() const noexcept
+  {
+    return m_nBufferedBytes;
+  }
+
 private:
+  /**
+   * \brief Index key for PartialPackets.
+   */
+  using Key = std::tuple<
+    EndpointId, // remote endpoint
+    lp::Sequence // message identifier (sequence number of the first fragment)
+  >;
+
+  struct EndpointIdHash
+  {
+    size_t
+    operator()(const EndpointId& ep) const noexcept;
+  };
+
+  struct KeyHash
+  {
+    size_t
+    operator()(const Key& key) const noexcept;
+  };
+
+  /**
+   * \brief Partial packets ordered by their most recent activity, i.e., by expiration time.
+   */
+  struct ExpiryEntry
+  {
+    Key key;
+    time::steady_clock::time_point expiry;
+  };
+  using ExpiryQueue = std::list<ExpiryEntry>;
+
   /**
    * \brief Holds all fragments of a packet until reassembled.
    */
@@ -125,27 +194,41 @@ private:
     std::vector<lp::Packet> fragments;
     size_t fragCount; ///< total fragments
     size_t nReceivedFragments; ///< number of received fragments
-    ndn::scheduler::ScopedEventId dropTimer;
+    size_t nBytes; ///< octets accounted to this partial packet
+    ExpiryQueue::iterator expiryIt;
   };
 
+  using PartialPacketMap = std::unordered_map<Key, PartialPacket, KeyHash>;
+
+  static Block
+  doReassembly(const PartialPacket& pp);
+
   /**
-   * \brief Index key for PartialPackets.
+   * \brief Evicts least recently active partial packets until \p nBytes more octets fit
+   *        within Options::maxBufferedBytes.
+   * \param key partial packet that must not be evicted
+   * \return whether enough space is available
    */
-  using Key = std::tuple<
-    EndpointId, // remote endpoint
-    lp::Sequence // message identifier (sequence number of the first fragment)
-  >;
+  bool
+  makeRoom(size_t nBytes, const Key& key);
 
-  Block
-  doReassembly(const Key& key);
+  void
+  erasePartialPacket(PartialPacketMap::iterator it);
+
+  void
+  scheduleExpiry();
 
   void
-  timeoutPartialPacket(const Key& key);
+  expirePartialPackets();
 
 private:
   Options m_options;
   const LinkService* m_linkService;
-  std::map<Key, PartialPacket> m_partialPackets;
+  PartialPacketMap m_partialPackets;
+  ExpiryQueue m_expiryQueue;
+  ndn::scheduler::ScopedEventId m_expiryTimer;
+  std::unordered_map<EndpointId, size_t, EndpointIdHash> m_endpointBytes;
+  size_t m_nBufferedBytes = 0;
 };
 
 std::ostream&
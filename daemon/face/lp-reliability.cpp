@@ -30,7 +30,7 @@
 
 #include <ndn-cxx/lp/fields.hpp>
 
-#include <set>
+#include <algorithm>
 
 namespace nfd::face {
 
@@ -39,7 +39,7 @@ NFD_LOG_INIT(LpReliability);
 LpReliability::LpReliability(const LpReliability::Options& options, GenericLinkService* linkService)
   : m_options(options)
   , m_linkService(linkService)
-  , m_firstUnackedFrag(m_unackedFrags.begin())
+  , m_rtoTimer([this] { onRtoTimerExpired(); })
   , m_lastTxSeqNo(-1) // set to "-1" to start TxSequence numbers at 0
 {
   BOOST_ASSERT(m_linkService != nullptr);
@@ -63,8 +63,8 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
 {
   BOOST_ASSERT(m_options.isEnabled);
 
-  auto unackedFragsIt = m_unackedFrags.begin();
   auto sendTime = time::steady_clock::now();
+  auto rto = m_rttEst.getEstimatedRto();
 
   auto netPkt = make_shared<NetPkt>(std::move(pkt), isInterest);
   netPkt->unackedFrags.reserve(frags.size());
@@ -77,23 +77,16 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
     lp::Sequence txSeq = assignTxSequence(frag);
 
     // Store LpPacket for future retransmissions
-    unackedFragsIt = m_unackedFrags.try_emplace(unackedFragsIt, txSeq, frag);
-    unackedFragsIt->second.sendTime = sendTime;
-    auto rto = m_rttEst.getEstimatedRto();
+    auto& unackedFrag = m_unackedFrags.emplace(txSeq, frag);
+    unackedFrag.sendTime = sendTime;
+    unackedFrag.netPkt = netPkt;
     lp::Sequence seq = frag.get<lp::SequenceField>();
     NFD_LOG_FACE_TRACE("transmitting seq=" << seq << ", txseq=" << txSeq << ", rto=" <<
                        time::duration_cast<time::milliseconds>(rto).count() << "ms");
-    unackedFragsIt->second.rtoTimer = getScheduler().schedule(rto, [=] {
-      onLpPacketLost(txSeq, true);
-    });
-    unackedFragsIt->second.netPkt = netPkt;
-
-    if (m_unackedFrags.size() == 1) {
-      m_firstUnackedFrag = m_unackedFrags.begin();
-    }
+    startRtoTimer(txSeq, rto);
 
     // Add to associated NetPkt
-    netPkt->unackedFrags.push_back(unackedFragsIt);
+    netPkt->unackedFrags.push_back(txSeq);
   }
 }
 
@@ -105,53 +98,52 @@ LpReliability::processIncomingPacket(const lp::Packet& pkt)
   bool isDuplicate = false;
   auto now = time::steady_clock::now();
 
-  // Extract and parse Acks
+  // Extract and parse Acks. All Acks in the packet are applied before looking for lost fragments,
+  // so that the send window is traversed only once per incoming packet.
+  lp::Sequence windowStart = m_unackedFrags.empty() ? 0 : m_unackedFrags.firstTxSeq();
+  std::vector<lp::Sequence> ackOffsets;
   for (lp::Sequence ackTxSeq : pkt.list<lp::AckField>()) {
-    auto fragIt = m_unackedFrags.find(ackTxSeq);
-    if (fragIt == m_unackedFrags.end()) {
+    auto frag = m_unackedFrags.find(ackTxSeq);
+    if (frag == nullptr) {
       // Ignore an Ack for an unknown TxSequence number
       NFD_LOG_FACE_DEBUG("received ack for unknown txseq=" << ackTxSeq);
       continue;
     }
-    auto& frag = fragIt->second;
-
-    // Cancel the RTO timer for the acknowledged fragment
-    frag.rtoTimer.cancel();
 
-    if (frag.retxCount == 0) {
-      NFD_LOG_FACE_TRACE("received ack for seq=" << frag.pkt.get<lp::SequenceField>() << ", txseq=" <<
+    if (frag->retxCount == 0) {
+      NFD_LOG_FACE_TRACE("received ack for seq=" << frag->pkt.get<lp::SequenceField>() << ", txseq=" <<
                          ackTxSeq << ", retx=0, rtt=" <<
-                         time::duration_cast<time::milliseconds>(now - frag.sendTime).count() << "ms");
+                         time::duration_cast<time::milliseconds>(now - frag->sendTime).count() << "ms");
       // This sequence had no retransmissions, so use it to estimate the RTO
-      m_rttEst.addMeasurement(now - frag.sendTime);
+      m_rttEst.addMeasurement(now - frag->sendTime);
     }
     else {
-      NFD_LOG_FACE_TRACE("received ack for seq=" << frag.pkt.get<lp::SequenceField>() << ", txseq=" <<
-                         ackTxSeq << ", retx=" << frag.retxCount);
+      NFD_LOG_FACE_TRACE("received ack for seq=" << frag->pkt.get<lp::SequenceField>() << ", txseq=" <<
+                         ackTxSeq << ", retx=" << frag->retxCount);
     }
 
+    ackOffsets.push_back(ackTxSeq - windowStart);
+
+    // Remove the fragment from the window of unacknowledged fragments and from its associated
+    // network packet. Potentially increment the start of the window. A pending retransmission
+    // timeout for this fragment will be ignored.
+    onLpPacketAcknowledged(ackTxSeq);
+  }
+
+  if (!ackOffsets.empty()) {
+    std::sort(ackOffsets.begin(), ackOffsets.end());
+
     // Look for frags with TxSequence numbers < ackTxSeq (allowing for wraparound) and consider
     // them lost if a configurable number of Acks containing greater TxSequence numbers have been
     // received.
-    auto lostLpPackets = findLostLpPackets(fragIt);
-
-    // Remove the fragment from the map of unacknowledged fragments and from its associated network
-    // packet. Potentially increment the start of the window.
-    onLpPacketAcknowledged(fragIt);
-
-    // This set contains TxSequences that have been removed by onLpPacketLost below because they
-    // were part of a network packet that was removed due to a fragment exceeding retx, as well as
-    // any other TxSequences removed by onLpPacketLost. This prevents onLpPacketLost from being
-    // called later for an invalid iterator.
-    std::set<lp::Sequence> removedLpPackets;
+    auto lostLpPackets = findLostLpPackets(windowStart, ackOffsets);
 
     // Resend or fail fragments considered lost. Potentially increment the start of the window.
+    // A fragment may have been removed already, if it belonged to a network packet that was
+    // dropped due to another fragment exceeding the allowed number of retransmissions.
     for (lp::Sequence txSeq : lostLpPackets) {
-      if (removedLpPackets.find(txSeq) == removedLpPackets.end()) {
-        auto removedTxSeqs = onLpPacketLost(txSeq, false);
-        for (auto removedTxSeq : removedTxSeqs) {
-          removedLpPackets.insert(removedTxSeq);
-        }
+      if (m_unackedFrags.count(txSeq) > 0) {
+        onLpPacketLost(txSeq, false);
       }
     }
   }
@@ -166,11 +158,15 @@ LpReliability::processIncomingPacket(const lp::Packet& pkt)
       lp::Sequence pktSequence = pkt.get<lp::SequenceField>();
       isDuplicate = m_recentRecvSeqs.count(pktSequence) > 0;
       // Check for recent received Sequences to remove
-      auto now = time::steady_clock::now();
       auto rto = m_rttEst.getEstimatedRto();
-      while (!m_recentRecvSeqsQueue.empty() &&
-             now > m_recentRecvSeqs[m_recentRecvSeqsQueue.front()] + rto) {
-        m_recentRecvSeqs.erase(m_recentRecvSeqsQueue.front());
+      while (!m_recentRecvSeqsQueue.empty()) {
+        auto it = m_recentRecvSeqs.find(m_recentRecvSeqsQueue.front());
+        if (it != m_recentRecvSeqs.end()) {
+          if (now <= it->second + rto) {
+            break;
+          }
+          m_recentRecvSeqs.erase(it);
+        }
         m_recentRecvSeqsQueue.pop();
       }
       m_recentRecvSeqs.try_emplace(pktSequence, now);
@@ -220,7 +216,7 @@ LpReliability::assignTxSequence(lp::Packet& frag)
 {
   lp::Sequence txSeq = ++m_lastTxSeqNo;
   frag.set<lp::TxSequenceField>(txSeq);
-  if (!m_unackedFrags.empty() && m_lastTxSeqNo == m_firstUnackedFrag->first) {
+  if (!m_unackedFrags.empty() && m_lastTxSeqNo == m_unackedFrags.firstTxSeq()) {
     NDN_THROW(std::length_error("TxSequence range exceeded"));
   }
   return m_lastTxSeqNo;
@@ -241,43 +237,80 @@ LpReliability::startIdleAckTimer()
   });
 }
 
+void
+LpReliability::startRtoTimer(lp::Sequence txSeq, time::nanoseconds rto)
+{
+  m_rtoDeadlines.push({time::steady_clock::now() + rto, txSeq});
+
+  // re-arm the timer only if this fragment now has the earliest deadline
+  if (m_rtoDeadlines.top().txSeq == txSeq) {
+    getTimerWheel().schedule(m_rtoTimer, rto);
+  }
+}
+
+void
+LpReliability::onRtoTimerExpired()
+{
+  auto now = time::steady_clock::now();
+
+  while (!m_rtoDeadlines.empty() && m_rtoDeadlines.top().deadline <= now) {
+    lp::Sequence txSeq = m_rtoDeadlines.top().txSeq;
+    m_rtoDeadlines.pop();
+
+    // skip fragments that have been acknowledged or retransmitted under another TxSequence
+    if (m_unackedFrags.count(txSeq) > 0) {
+      onLpPacketLost(txSeq, true);
+    }
+  }
+
+  if (!m_rtoDeadlines.empty()) {
+    getTimerWheel().schedule(m_rtoTimer, m_rtoDeadlines.top().deadline - now);
+  }
+}
+
 std::vector<lp::Sequence>
-LpReliability::findLostLpPackets(LpReliability::UnackedFrags::iterator ackIt)
+LpReliability::findLostLpPackets(lp::Sequence windowStart, const std::vector<lp::Sequence>& ackOffsets)
 {
   std::vector<lp::Sequence> lostLpPackets;
+  if (m_unackedFrags.empty()) {
+    return lostLpPackets;
+  }
 
-  for (auto it = m_firstUnackedFrag; ; ++it) {
-    if (it == m_unackedFrags.end()) {
-      it = m_unackedFrags.begin();
+  // Every fragment before the last acknowledged one is credited with the number of Acks
+  // for greater TxSequences. Acknowledged fragments are no longer in the window.
+  auto nextAck = ackOffsets.begin();
+  for (lp::Sequence offset = m_unackedFrags.firstTxSeq() - windowStart;
+       offset < ackOffsets.back(); ++offset) {
+    while (*nextAck < offset) {
+      ++nextAck;
     }
 
-    if (it->first == ackIt->first) {
-      break;
+    lp::Sequence txSeq = windowStart + offset;
+    auto unackedFrag = m_unackedFrags.find(txSeq);
+    if (unackedFrag == nullptr) {
+      continue;
     }
 
-    auto& unackedFrag = it->second;
-    unackedFrag.nGreaterSeqAcks++;
-    NFD_LOG_FACE_TRACE("received ack=" << ackIt->first << " before=" << it->first <<
-                       ", before count=" << unackedFrag.nGreaterSeqAcks);
+    size_t nGreaterAcks = std::distance(nextAck, ackOffsets.end());
+    unackedFrag->nGreaterSeqAcks += nGreaterAcks;
+    NFD_LOG_FACE_TRACE("received " << nGreaterAcks << " acks after txseq=" << txSeq <<
+                       ", before count=" << unackedFrag->nGreaterSeqAcks);
 
-    if (unackedFrag.nGreaterSeqAcks >= m_options.seqNumLossThreshold) {
-      lostLpPackets.push_back(it->first);
+    if (unackedFrag->nGreaterSeqAcks >= m_options.seqNumLossThreshold) {
+      lostLpPackets.push_back(txSeq);
     }
   }
 
   return lostLpPackets;
 }
 
-std::vector<lp::Sequence>
+void
 LpReliability::onLpPacketLost(lp::Sequence txSeq, bool isTimeout)
 {
   BOOST_ASSERT(m_unackedFrags.count(txSeq) > 0);
-  auto txSeqIt = m_unackedFrags.find(txSeq);
+  auto& txFrag = m_unackedFrags.at(txSeq);
 
-  auto& txFrag = txSeqIt->second;
-  txFrag.rtoTimer.cancel();
   auto netPkt = txFrag.netPkt;
-  std::vector<lp::Sequence> removedThisTxSeq;
   lp::Sequence seq = txFrag.pkt.get<lp::SequenceField>();
 
   if (isTimeout) {
@@ -292,10 +325,9 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq, bool isTimeout)
   if (txFrag.retxCount >= m_options.maxRetx) {
     NFD_LOG_FACE_DEBUG("seq=" << seq << " exceeded allowed retransmissions: DROP");
     // Delete all LpPackets of NetPkt from m_unackedFrags (except this one)
-    for (size_t i = 0; i < netPkt->unackedFrags.size(); i++) {
-      if (netPkt->unackedFrags[i] != txSeqIt) {
-        removedThisTxSeq.push_back(netPkt->unackedFrags[i]->first);
-        deleteUnackedFrag(netPkt->unackedFrags[i]);
+    for (lp::Sequence fragTxSeq : netPkt->unackedFrags) {
+      if (fragTxSeq != txSeq) {
+        deleteUnackedFrag(fragTxSeq);
       }
     }
 
@@ -309,55 +341,48 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq, bool isTimeout)
     }
 
     // Delete this LpPacket from m_unackedFrags
-    removedThisTxSeq.push_back(txSeqIt->first);
-    deleteUnackedFrag(txSeqIt);
+    deleteUnackedFrag(txSeq);
   }
   else {
     // Assign new TxSequence
     lp::Sequence newTxSeq = assignTxSequence(txFrag.pkt);
     netPkt->didRetx = true;
 
-    // Move fragment to new TxSequence mapping
-    auto hint = m_firstUnackedFrag != m_unackedFrags.end() && m_firstUnackedFrag->first > newTxSeq
-                ? m_firstUnackedFrag
-                : m_unackedFrags.end();
-    auto newTxFragIt = m_unackedFrags.try_emplace(hint, newTxSeq, txFrag.pkt);
-    auto& newTxFrag = newTxFragIt->second;
-    newTxFrag.retxCount = txFrag.retxCount + 1;
+    // Move fragment to new TxSequence. The old entry is removed first, because appending to
+    // the window may relocate the fragments stored in it.
+    lp::Packet pkt = std::move(txFrag.pkt);
+    size_t retxCount = txFrag.retxCount + 1;
+    deleteUnackedFrag(txSeq);
+
+    auto& newTxFrag = m_unackedFrags.emplace(newTxSeq, std::move(pkt));
+    newTxFrag.retxCount = retxCount;
     newTxFrag.netPkt = netPkt;
 
     // Update associated NetPkt
-    auto fragInNetPkt = std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), txSeqIt);
+    auto fragInNetPkt = std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), txSeq);
     BOOST_ASSERT(fragInNetPkt != netPkt->unackedFrags.end());
-    *fragInNetPkt = newTxFragIt;
-
-    removedThisTxSeq.push_back(txSeqIt->first);
-    deleteUnackedFrag(txSeqIt);
+    *fragInNetPkt = newTxSeq;
 
     // Retransmit fragment
     m_linkService->sendLpPacket(lp::Packet(newTxFrag.pkt));
 
     auto rto = m_rttEst.getEstimatedRto();
     NFD_LOG_FACE_TRACE("retransmitting seq=" << seq << ", txseq=" << newTxSeq << ", retx=" <<
-                       txFrag.retxCount << ", rto=" <<
+                       retxCount << ", rto=" <<
                        time::duration_cast<time::milliseconds>(rto).count() << "ms");
 
     // Start RTO timer for this sequence
-    newTxFrag.rtoTimer = getScheduler().schedule(rto, [=] {
-      onLpPacketLost(newTxSeq, true);
-    });
+    startRtoTimer(newTxSeq, rto);
   }
-
-  return removedThisTxSeq;
 }
 
 void
-LpReliability::onLpPacketAcknowledged(UnackedFrags::iterator fragIt)
+LpReliability::onLpPacketAcknowledged(lp::Sequence txSeq)
 {
-  auto netPkt = fragIt->second.netPkt;
+  auto netPkt = m_unackedFrags.at(txSeq).netPkt;
 
   // Remove from NetPkt unacked fragment list
-  auto fragInNetPkt = std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), fragIt);
+  auto fragInNetPkt = std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), txSeq);
   BOOST_ASSERT(fragInNetPkt != netPkt->unackedFrags.end());
   *fragInNetPkt = netPkt->unackedFrags.back();
   netPkt->unackedFrags.pop_back();
@@ -372,28 +397,97 @@ LpReliability::onLpPacketAcknowledged(UnackedFrags::iterator fragIt)
     }
   }
 
-  deleteUnackedFrag(fragIt);
+  deleteUnackedFrag(txSeq);
 }
 
 void
-LpReliability::deleteUnackedFrag(UnackedFrags::iterator fragIt)
+LpReliability::deleteUnackedFrag(lp::Sequence txSeq)
 {
-  lp::Sequence firstUnackedTxSeq = m_firstUnackedFrag->first;
-  lp::Sequence currentTxSeq = fragIt->first;
-  auto nextFragIt = m_unackedFrags.erase(fragIt);
-
-  if (!m_unackedFrags.empty() && firstUnackedTxSeq == currentTxSeq) {
-    // If "first" fragment in send window (allowing for wraparound), increment window begin
-    if (nextFragIt == m_unackedFrags.end()) {
-      m_firstUnackedFrag = m_unackedFrags.begin();
-    }
-    else {
-      m_firstUnackedFrag = nextFragIt;
-    }
+  m_unackedFrags.erase(txSeq);
+
+  if (m_unackedFrags.empty()) {
+    // all remaining deadlines belong to fragments that are gone
+    m_rtoDeadlines = decltype(m_rtoDeadlines){};
+    m_rtoTimer.cancel();
+  }
+}
+
+const LpReliability::UnackedFrag*
+LpReliability::UnackedFrags::find(lp::Sequence txSeq) const noexcept
+{
+  // unsigned arithmetic takes care of TxSequence wraparound
+  if (txSeq - m_first >= m_span) {
+    return nullptr;
+  }
+
+  const auto& entry = m_slots[txSeq & (m_slots.size() - 1)];
+  return entry ? &*entry : nullptr;
+}
+
+LpReliability::UnackedFrag&
+LpReliability::UnackedFrags::at(lp::Sequence txSeq)
+{
+  auto frag = find(txSeq);
+  if (frag == nullptr) {
+    NDN_THROW(std::out_of_range("TxSequence " + std::to_string(txSeq) + " is not in the window"));
+  }
+  return *frag;
+}
+
+LpReliability::UnackedFrag&
+LpReliability::UnackedFrags::emplace(lp::Sequence txSeq, lp::Packet pkt)
+{
+  if (empty()) {
+    m_first = txSeq;
+    m_span = 0;
+  }
+  BOOST_ASSERT(txSeq == m_first + m_span);
+
+  if (m_span == m_slots.size()) {
+    grow();
+  }
+
+  auto& entry = slot(txSeq);
+  entry.emplace(std::move(pkt));
+  ++m_span;
+  ++m_size;
+  return *entry;
+}
+
+void
+LpReliability::UnackedFrags::erase(lp::Sequence txSeq)
+{
+  BOOST_ASSERT(count(txSeq) == 1);
+  slot(txSeq).reset();
+  --m_size;
+
+  if (empty()) {
+    m_span = 0;
+    return;
   }
-  else if (m_unackedFrags.empty()) {
-    m_firstUnackedFrag = m_unackedFrags.end();
+
+  // If "first" fragment in send window (allowing for wraparound), advance window begin
+  // past any fragments that have already been acknowledged
+  if (txSeq == m_first) {
+    do {
+      ++m_first;
+      --m_span;
+    } while (!slot(m_first));
+  }
+}
+
+void
+LpReliability::UnackedFrags::grow()
+{
+  std::vector<std::optional<UnackedFrag>> slots(std::max(m_slots.size() * 2, INITIAL_CAPACITY));
+  for (size_t offset = 0; offset < m_span; ++offset) {
+    lp::Sequence txSeq = m_first + offset;
+    auto& entry = slot(txSeq);
+    if (entry) {
+      slots[txSeq & (slots.size() - 1)] = std::move(entry);
+    }
   }
+  m_slots = std::move(slots);
 }
 
 std::ostream&
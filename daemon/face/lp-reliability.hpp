@@ -27,14 +27,16 @@
 #define NFD_DAEMON_FACE_LP_RELIABILITY_HPP
 
 #include "face-common.hpp"
+#include "common/timer-wheel.hpp"
 
 #include <ndn-cxx/lp/packet.hpp>
 #include <ndn-cxx/lp/sequence.hpp>
 #include <ndn-cxx/util/rtt-estimator.hpp>
 #include <ndn-cxx/util/scheduler.hpp>
 
-#include <map>
+#include <optional>
 #include <queue>
+#include <unordered_map>
 
 namespace nfd::face {
 
@@ -120,8 +122,8 @@ public:
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   class UnackedFrag;
+  class UnackedFrags;
   class NetPkt;
-  using UnackedFrags = std::map<lp::Sequence, UnackedFrag>;
 
   /** \brief Assign TxSequence number to a fragment.
    *  \param frag fragment to assign TxSequence to
@@ -140,39 +142,53 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   startIdleAckTimer();
 
+  /** \brief Arm the retransmission timeout of a fragment.
+   *
+   * All fragments on the link share a single TimerWheel timer, which is set to the earliest
+   * pending deadline.
+   */
+  void
+  startRtoTimer(lp::Sequence txSeq, time::nanoseconds rto);
+
+  /** \brief Declare lost all fragments whose retransmission timeout has expired.
+   */
+  void
+  onRtoTimerExpired();
+
   /** \brief Find and mark as lost fragments where a configurable number of Acks
    *         (Options::seqNumLossThreshold) have been received for greater TxSequence numbers.
-   *  \param ackIt iterator pointing to acknowledged fragment
+   *  \param windowStart start of the send window before the Acks were processed
+   *  \param ackOffsets offsets from \p windowStart of the fragments acknowledged by one
+   *                    incoming LpPacket, sorted in ascending order
    *  \return vector containing TxSequences of fragments marked lost by this mechanism
    */
   std::vector<lp::Sequence>
-  findLostLpPackets(UnackedFrags::iterator ackIt);
+  findLostLpPackets(lp::Sequence windowStart, const std::vector<lp::Sequence>& ackOffsets);
 
   /** \brief Resend (or give up on) a lost fragment.
-   *  \return vector of the TxSequences of fragments removed due to a network packet being removed
+   *
+   *  If the fragment exceeded the allowed number of retransmissions, all other fragments of
+   *  the same network packet are removed as well.
    */
-  std::vector<lp::Sequence>
+  void
   onLpPacketLost(lp::Sequence txSeq, bool isTimeout);
 
-  /** \brief Remove the fragment with the given sequence number from the map of unacknowledged
+  /** \brief Remove the fragment with the given sequence number from the window of unacknowledged
    *         fragments, as well as its associated network packet (if any).
-   *  \param fragIt iterator to acknowledged fragment
+   *  \param txSeq TxSequence of acknowledged fragment, must be in m_unackedFrags
    *
-   *  If the given TxSequence marks the beginning of the send window, the window will be incremented.
    *  If the associated network packet has been fully transmitted, it will be removed.
    */
   void
-  onLpPacketAcknowledged(UnackedFrags::iterator fragIt);
+  onLpPacketAcknowledged(lp::Sequence txSeq);
 
-  /** \brief Delete a fragment from UnackedFrags and advance acknowledge window if necessary.
-   *  \param fragIt iterator to an UnackedFrag, must be dereferencable
-   *  \post fragIt is not in m_unackedFrags
-   *  \post if was equal to m_firstUnackedFrag,
-   *        m_firstUnackedFrag is set to the UnackedFrag after fragIt with consideration of
-   *        TxSequence number wraparound, or set to m_unackedFrags.end() if m_unackedFrags is empty
+  /** \brief Delete a fragment from UnackedFrags.
+   *  \param txSeq TxSequence of an UnackedFrag, must be in m_unackedFrags
+   *  \post txSeq is not in m_unackedFrags
+   *  \post if m_unackedFrags is empty, no retransmission timeout is pending
    */
   void
-  deleteUnackedFrag(UnackedFrags::iterator fragIt);
+  deleteUnackedFrag(lp::Sequence txSeq);
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /**
@@ -189,13 +205,102 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
   public:
     lp::Packet pkt;
-    ndn::scheduler::ScopedEventId rtoTimer;
     time::steady_clock::time_point sendTime = time::steady_clock::now();
     size_t retxCount = 0;
     size_t nGreaterSeqAcks = 0; ///< Number of Acks received for sequences greater than this fragment
     shared_ptr<NetPkt> netPkt;
   };
 
+  /**
+   * \brief Send window of unacknowledged fragments, indexed by TxSequence.
+   *
+   * The window covers a contiguous range of TxSequence numbers starting at firstTxSeq(), some of
+   * which may already be acknowledged. Fragments are stored in a circular buffer at the position
+   * given by their TxSequence modulo the buffer capacity, which is doubled whenever the range
+   * would no longer fit. TxSequence numbers are allowed to wrap around.
+   */
+  class UnackedFrags
+  {
+  public:
+    bool
+    empty() const noexcept
+    {
+      return m_size == 0;
+    }
+
+    /** \brief Returns the number of unacknowledged fragments.
+     */
+    size_t
+    size() const noexcept
+    {
+      return m_size;
+    }
+
+    /** \brief Returns the TxSequence at the beginning of the window.
+     *  \pre !empty()
+     */
+    lp::Sequence
+    firstTxSeq() const noexcept
+    {
+      BOOST_ASSERT(!empty());
+      return m_first;
+    }
+
+    size_t
+    count(lp::Sequence txSeq) const noexcept
+    {
+      return find(txSeq) != nullptr ? 1 : 0;
+    }
+
+    /** \brief Returns the fragment with the given TxSequence, or nullptr if it does not exist.
+     */
+    UnackedFrag*
+    find(lp::Sequence txSeq) noexcept
+    {
+      return const_cast<UnackedFrag*>(std::as_const(*this).find(txSeq));
+    }
+
+    const UnackedFrag*
+    find(lp::Sequence txSeq) const noexcept;
+
+    /** \brief Returns the fragment with the given TxSequence.
+     *  \throw std::out_of_range the fragment does not exist
+     */
+    UnackedFrag&
+    at(lp::Sequence txSeq);
+
+    /** \brief Append a fragment at the end of the window.
+     *  \pre empty() or \p txSeq immediately follows the last TxSequence in the window
+     *  \warning References to other fragments are invalidated if the buffer is enlarged.
+     */
+    UnackedFrag&
+    emplace(lp::Sequence txSeq, lp::Packet pkt);
+
+    /** \brief Remove a fragment, advancing the beginning of the window if necessary.
+     *  \pre count(txSeq) == 1
+     */
+    void
+    erase(lp::Sequence txSeq);
+
+  private:
+    std::optional<UnackedFrag>&
+    slot(lp::Sequence txSeq) noexcept
+    {
+      return m_slots[txSeq & (m_slots.size() - 1)];
+    }
+
+    void
+    grow();
+
+  private:
+    static constexpr size_t INITIAL_CAPACITY = 64;
+
+    std::vector<std::optional<UnackedFrag>> m_slots;
+    lp::Sequence m_first = 0; ///< TxSequence at the beginning of the window
+    size_t m_span = 0;        ///< number of TxSequences covered by the window
+    size_t m_size = 0;        ///< number of unacknowledged fragments in the window
+  };
+
   /**
    * \brief Contains a network-layer packet with unacknowledged fragments.
    */
@@ -209,22 +314,38 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     }
 
   public:
-    std::vector<UnackedFrags::iterator> unackedFrags;
+    std::vector<lp::Sequence> unackedFrags;
     lp::Packet pkt;
     bool isInterest;
     bool didRetx = false;
   };
 
+  /**
+   * \brief Retransmission deadline of a fragment.
+   *
+   * Entries are not removed when a fragment is acknowledged; they are skipped on expiry instead.
+   */
+  struct RtoDeadline
+  {
+    time::steady_clock::time_point deadline;
+    lp::Sequence txSeq;
+
+    friend bool
+    operator>(const RtoDeadline& lhs, const RtoDeadline& rhs) noexcept
+    {
+      // ties are broken by transmission order, allowing for TxSequence wraparound
+      return lhs.deadline > rhs.deadline ||
+             (lhs.deadline == rhs.deadline && static_cast<int64_t>(lhs.txSeq - rhs.txSeq) > 0);
+    }
+  };
+
   Options m_options;
   GenericLinkService* m_linkService = nullptr;
   UnackedFrags m_unackedFrags;
-  // An iterator that points to the first unacknowledged fragment in the current window. The window
-  // can wrap around so that the beginning of the window is at a TxSequence greater than other
-  // fragments in the window. When the window is moved past the last item in the iterator, the
-  // first fragment in the map will become the start of the window.
-  UnackedFrags::iterator m_firstUnackedFrag;
+  std::priority_queue<RtoDeadline, std::vector<RtoDeadline>, std::greater<>> m_rtoDeadlines;
+  TimerWheel::Timer m_rtoTimer;
   std::queue<lp::Sequence> m_ackQueue;
-  std::map<lp::Sequence, time::steady_clock::time_point> m_recentRecvSeqs;
+  std::unordered_map<lp::Sequence, time::steady_clock::time_point> m_recentRecvSeqs;
   std::queue<lp::Sequence> m_recentRecvSeqsQueue;
   lp::Sequence m_lastTxSeqNo;
   ndn::scheduler::ScopedEventId m_idleAckTimer;
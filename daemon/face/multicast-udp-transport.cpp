@@ -47,11 +47,14 @@ NFD_LOG_MEMBER_INIT_SPECIALIZED((DatagramTransport<ip::udp, Multicast>), Multica
 MulticastUdpTransport::MulticastUdpTransport(const ip::udp::endpoint& multicastGroup,
                                              ip::udp::socket&& recvSocket,
                                              ip::udp::socket&& sendSocket,
-                                             ndn::nfd::LinkType linkType)
-  : DatagramTransport(std::move(recvSocket))
+                                             ndn::nfd::LinkType linkType,
+                                             size_t batchSize)
+  : DatagramTransport(std::move(recvSocket), batchSize)
   , m_multicastGroup(multicastGroup)
   , m_sendSocket(std::move(sendSocket))
 {
+  this->setBatchSendSocket(m_sendSocket, m_multicastGroup);
+
   this->setLocalUri(FaceUri(m_sendSocket.local_endpoint()));
   this->setRemoteUri(FaceUri(multicastGroup));
   this->setScope(ndn::nfd::FACE_SCOPE_NON_LOCAL);
@@ -88,6 +91,10 @@ MulticastUdpTransport::doSend(const Block& packet)
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+  if (isBatchSendEnabled()) {
+    return enqueueSend(packet);
+  }
+
   m_sendSocket.async_send_to(boost::asio::buffer(packet), m_multicastGroup,
                              // 'packet' is copied into the lambda to retain the underlying Buffer
                              [this, packet] (auto&&... args) {
@@ -53,11 +53,13 @@ public:
    * \param recvSocket socket used to receive multicast packets
    * \param sendSocket socket used to send to the multicast group
    * \param linkType either `ndn::nfd::LINK_TYPE_MULTI_ACCESS` or `ndn::nfd::LINK_TYPE_AD_HOC`
+   * \param batchSize maximum number of datagrams received or sent in one system call
    */
   MulticastUdpTransport(const boost::asio::ip::udp::endpoint& multicastGroup,
                         boost::asio::ip::udp::socket&& recvSocket,
                         boost::asio::ip::udp::socket&& sendSocket,
-                        ndn::nfd::LinkType linkType);
+                        ndn::nfd::LinkType linkType,
+                        size_t batchSize = 1);
 
   ssize_t
   getSendQueueLength() final;
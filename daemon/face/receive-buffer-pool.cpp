@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "receive-buffer-pool.hpp"
+
+#include <ndn-cxx/encoding/tlv.hpp>
+
+namespace nfd::face {
+
+ReceiveBufferPool::ReceiveBufferPool(size_t bufferSize, size_t capacity)
+  : m_bufferSize(bufferSize)
+  , m_capacity(capacity)
+  // an element smaller than a quarter of the buffer is cheaper to copy than to pin the buffer
+  , m_zeroCopyThreshold(bufferSize / 4)
+{
+  m_free.reserve(capacity);
+}
+
+shared_ptr<ndn::Buffer>
+ReceiveBufferPool::acquire()
+{
+  // recycle the oldest released buffers that are no longer referenced;
+  // a buffer that is still referenced blocks the others until it is forgotten below
+  while (!m_pending.empty() && m_pending.front().use_count() == 1) {
+    m_free.push_back(std::move(m_pending.front()));
+    m_pending.pop_front();
+  }
+
+  if (!m_free.empty()) {
+    auto buffer = std::move(m_free.back());
+    m_free.pop_back();
+    ++m_nReused;
+    return buffer;
+  }
+
+  ++m_nAllocated;
+  return std::make_shared<ndn::Buffer>(m_bufferSize);
+}
+
+void
+ReceiveBufferPool::release(shared_ptr<ndn::Buffer> buffer)
+{
+  if (buffer == nullptr || buffer->size() != m_bufferSize)
+    return;
+
+  if (buffer.use_count() == 1) {
+    if (m_free.size() + m_pending.size() < m_capacity)
+      m_free.push_back(std::move(buffer));
+    return;
+  }
+
+  if (m_free.size() + m_pending.size() >= m_capacity) {
+    if (m_pending.empty())
+      return;
+    // forget the oldest buffer, it is freed when its last packet is dropped
+    m_pending.pop_front();
+  }
+  m_pending.push_back(std::move(buffer));
+}
+
+std::tuple<bool, Block>
+ReceiveBufferPool::decode(const shared_ptr<ndn::Buffer>& buffer, span<const uint8_t> bytes) const
+{
+  BOOST_ASSERT(bytes.data() >= buffer->data() &&
+               bytes.data() + bytes.size() <= buffer->data() + buffer->size());
+
+  auto pos = bytes.begin();
+  const auto end = bytes.end();
+  uint32_t type = 0;
+  uint64_t length = 0;
+  if (!ndn::tlv::readType(pos, end, type) ||
+      !ndn::tlv::readVarNumber(pos, end, length) ||
+      length > static_cast<uint64_t>(std::distance(pos, end))) {
+    return {false, {}};
+  }
+  size_t elementSize = static_cast<size_t>(std::distance(bytes.begin(), pos)) + length;
+
+  if (elementSize < m_zeroCopyThreshold) {
+    return Block::fromBuffer(bytes.first(elementSize));
+  }
+
+  auto begin = buffer->cbegin() + (bytes.data() - buffer->data());
+  return {true, Block(buffer, begin, begin + elementSize, false)};
+}
+
+ReceiveBufferPool&
+getReceiveBufferPool()
+{
+  // buffers still referenced by packets outlive the pool, so destroying it at thread exit is safe
+  static thread_local ReceiveBufferPool pool;
+  return pool;
+}
+
+} // namespace nfd::face
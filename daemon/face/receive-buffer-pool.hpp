@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_RECEIVE_BUFFER_POOL_HPP
+#define NFD_DAEMON_FACE_RECEIVE_BUFFER_POOL_HPP
+
+#include "face-common.hpp"
+
+#include <deque>
+
+namespace nfd::face {
+
+/**
+ * \brief Recycles receive buffers that can be shared with the decoded packets.
+ *
+ * A transport receives into a buffer obtained from acquire(). Elements decoded with
+ * decode() reference that buffer instead of being copied into a new one, provided they
+ * are large enough (see getZeroCopyThreshold()); smaller elements are copied, so that a
+ * small packet kept in the Content Store does not pin a whole receive buffer. The Content
+ * Store itself keeps a compact copy of any Data whose buffer is much larger than the Data.
+ *
+ * When a buffer is referenced by decoded packets, the transport hands it back with
+ * release() and acquires another one. The pool keeps released buffers and hands them out
+ * again once all packets referencing them have been dropped. Buffers that stay referenced
+ * for too long (e.g., by the Content Store) are forgotten by the pool and freed normally
+ * when the last packet goes away.
+ *
+ * \note ReceiveBufferPool is not thread-safe. Use getReceiveBufferPool() to obtain the
+ *       calling thread's pool.
+ */
+class ReceiveBufferPool : noncopyable
+{
+public:
+  /**
+   * \param bufferSize size of each buffer
+   * \param capacity maximum number of buffers kept by the pool, both free and still referenced
+   */
+  explicit
+  ReceiveBufferPool(size_t bufferSize = ndn::MAX_NDN_PACKET_SIZE, size_t capacity = 256);
+
+  /**
+   * \brief Returns a buffer of getBufferSize() octets that is not referenced anywhere else.
+   */
+  shared_ptr<ndn::Buffer>
+  acquire();
+
+  /**
+   * \brief Gives back a buffer obtained from acquire().
+   *
+   * The buffer may still be referenced by decoded packets; it is reused only after
+   * they have all been dropped.
+   */
+  void
+  release(shared_ptr<ndn::Buffer> buffer);
+
+  /**
+   * \brief Decodes the TLV element at the beginning of \p bytes.
+   * \param buffer the buffer that contains \p bytes
+   * \param bytes the received octets, which must lie within \p buffer
+   * \return a tuple of whether a complete element was decoded, and the element;
+   *         the element references \p buffer if it is at least getZeroCopyThreshold() octets
+   */
+  std::tuple<bool, Block>
+  decode(const shared_ptr<ndn::Buffer>& buffer, span<const uint8_t> bytes) const;
+
+  size_t
+  getBufferSize() const noexcept
+  {
+    return m_bufferSize;
+  }
+
+  /**
+   * \brief Returns the minimum size of an element that is decoded without copying.
+   */
+  size_t
+  getZeroCopyThreshold() const noexcept
+  {
+    return m_zeroCopyThreshold;
+  }
+
+  /**
+   * \brief Returns the number of buffers allocated since the pool was created.
+   */
+  size_t
+  getNAllocated() const noexcept
+  {
+    return m_nAllocated;
+  }
+
+  /**
+   * \brief Returns the number of buffers handed out again after being released.
+   */
+  size_t
+  getNReused() const noexcept
+  {
+    return m_nReused;
+  }
+
+private:
+  size_t m_bufferSize;
+  size_t m_capacity;
+  size_t m_zeroCopyThreshold;
+  std::vector<shared_ptr<ndn::Buffer>> m_free;
+  /// released buffers that were still referenced, oldest first
+  std::deque<shared_ptr<ndn::Buffer>> m_pending;
+  size_t m_nAllocated = 0;
+  size_t m_nReused = 0;
+};
+
+/**
+ * \brief Returns the calling thread's ReceiveBufferPool.
+ */
+ReceiveBufferPool&
+getReceiveBufferPool();
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_RECEIVE_BUFFER_POOL_HPP
@@ -0,0 +1,168 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "shared-udp-transport.hpp"
+#include "udp-protocol.hpp"
+#include "common/global.hpp"
+
+#include <boost/asio/defer.hpp>
+
+namespace nfd::face {
+
+NFD_LOG_INIT(SharedUdpTransport);
+
+SharedUdpTransport::SharedUdpTransport(boost::asio::ip::udp::socket& socket,
+                                       const boost::asio::ip::udp::endpoint& remoteEndpoint,
+                                       ndn::nfd::FacePersistency persistency,
+                                       time::nanoseconds idleTimeout)
+  : m_socket(socket)
+  , m_remoteEndpoint(remoteEndpoint)
+  , m_idleTimeout(idleTimeout)
+{
+  this->setLocalUri(FaceUri(m_socket.local_endpoint()));
+  this->setRemoteUri(FaceUri(m_remoteEndpoint));
+  this->setScope(ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  this->setPersistency(persistency);
+  this->setLinkType(ndn::nfd::LINK_TYPE_POINT_TO_POINT);
+  this->setMtu(udp::computeMtu(m_socket.local_endpoint()));
+
+  NFD_LOG_FACE_DEBUG("Creating transport");
+
+  if (getPersistency() == ndn::nfd::FACE_PERSISTENCY_ON_DEMAND &&
+      m_idleTimeout > time::nanoseconds::zero()) {
+    scheduleClosureWhenIdle();
+  }
+}
+
+void
+SharedUdpTransport::receiveDatagram(span<const uint8_t> buffer)
+{
+  NFD_LOG_FACE_TRACE("Received: " << buffer.size() << " bytes");
+
+  auto [isOk, element] = Block::fromBuffer(buffer);
+  if (!isOk) {
+    NFD_LOG_FACE_WARN("Failed to parse incoming packet");
+    // This packet won't extend the face lifetime
+    return;
+  }
+  if (element.size() != buffer.size()) {
+    NFD_LOG_FACE_WARN("Received datagram size and decoded element size don't match");
+    // This packet won't extend the face lifetime
+    return;
+  }
+
+  receiveElement(element);
+}
+
+void
+SharedUdpTransport::receiveElement(const Block& element)
+{
+  m_hasRecentlyReceived = true;
+  this->receive(element);
+}
+
+bool
+SharedUdpTransport::canChangePersistencyToImpl(ndn::nfd::FacePersistency newPersistency) const
+{
+  return true;
+}
+
+void
+SharedUdpTransport::afterChangePersistency(ndn::nfd::FacePersistency oldPersistency)
+{
+  if (getPersistency() == ndn::nfd::FACE_PERSISTENCY_ON_DEMAND &&
+      m_idleTimeout > time::nanoseconds::zero()) {
+    scheduleClosureWhenIdle();
+  }
+  else {
+    m_closeIfIdleEvent.cancel();
+    setExpirationTime(time::steady_clock::time_point::max());
+  }
+}
+
+void
+SharedUdpTransport::doClose()
+{
+  NFD_LOG_FACE_TRACE(__func__);
+
+  // the socket belongs to the channel and stays open
+  m_closeIfIdleEvent.cancel();
+
+  // Ensure that the Transport stays alive at least until
+  // all pending handlers are dispatched
+  boost::asio::defer(getGlobalIoService(), [this] {
+    this->setState(TransportState::CLOSED);
+  });
+}
+
+void
+SharedUdpTransport::doSend(const Block& packet)
+{
+  NFD_LOG_FACE_TRACE(__func__);
+
+  // The socket belongs to the channel, so doClose() cannot cancel an asynchronous send, whose
+  // completion could then run after this transport is gone. Send synchronously instead; the
+  // socket is in non-blocking mode, so a full send buffer results in a dropped datagram.
+  boost::system::error_code error;
+  size_t nBytesSent = m_socket.send_to(boost::asio::buffer(packet), m_remoteEndpoint, 0, error);
+  handleSend(error, nBytesSent);
+}
+
+void
+SharedUdpTransport::handleSend(const boost::system::error_code& error, size_t nBytesSent)
+{
+  if (!error) {
+    NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
+    return;
+  }
+
+  if (error == boost::asio::error::would_block || error == boost::asio::error::try_again) {
+    ++m_nSendDrops;
+    NFD_LOG_FACE_DEBUG("Send buffer full, dropping packet");
+    return;
+  }
+
+  // a send error on an unconnected socket concerns only this datagram,
+  // so it must not affect the other faces sharing the socket
+  NFD_LOG_FACE_DEBUG("Send operation failed: " << error.message());
+}
+
+void
+SharedUdpTransport::scheduleClosureWhenIdle()
+{
+  m_closeIfIdleEvent = getScheduler().schedule(m_idleTimeout, [this] {
+    if (!m_hasRecentlyReceived) {
+      NFD_LOG_FACE_INFO("Closing due to inactivity");
+      this->close();
+    }
+    else {
+      m_hasRecentlyReceived = false;
+      scheduleClosureWhenIdle();
+    }
+  });
+  setExpirationTime(time::steady_clock::now() + m_idleTimeout);
+}
+
+} // namespace nfd::face
@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_SHARED_UDP_TRANSPORT_HPP
+#define NFD_DAEMON_FACE_SHARED_UDP_TRANSPORT_HPP
+
+#include "transport.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include <boost/asio/ip/udp.hpp>
+
+namespace nfd::face {
+
+/**
+ * \brief A Transport that communicates with one unicast UDP peer through a socket
+ *        shared with other faces.
+ *
+ * The socket is owned by the UdpChannel that created the transport. The channel receives
+ * all incoming datagrams and demultiplexes them by remote endpoint; outgoing packets are
+ * sent with a synchronous, non-blocking `sendto()` on the shared socket.
+ */
+class SharedUdpTransport final : public Transport
+{
+public:
+  /**
+   * \param socket the shared socket; it must remain valid until the transport is closed
+   * \param remoteEndpoint the peer of this transport
+   * \param persistency initial persistency of the transport
+   * \param idleTimeout timeout for automatic closure of an idle on-demand transport
+   */
+  SharedUdpTransport(boost::asio::ip::udp::socket& socket,
+                     const boost::asio::ip::udp::endpoint& remoteEndpoint,
+                     ndn::nfd::FacePersistency persistency,
+                     time::nanoseconds idleTimeout);
+
+  /**
+   * \brief Receive a datagram demultiplexed to this transport, and deliver it to the link service.
+   */
+  void
+  receiveDatagram(span<const uint8_t> buffer);
+
+  /**
+   * \brief Deliver a datagram whose outer TLV element has already been decoded.
+   */
+  void
+  receiveElement(const Block& element);
+
+  /**
+   * \brief Number of outgoing packets dropped because the socket send buffer was full.
+   */
+  size_t
+  getNSendDrops() const noexcept
+  {
+    return m_nSendDrops;
+  }
+
+protected:
+  bool
+  canChangePersistencyToImpl(ndn::nfd::FacePersistency newPersistency) const final;
+
+  void
+  afterChangePersistency(ndn::nfd::FacePersistency oldPersistency) final;
+
+  void
+  doClose() final;
+
+private:
+  void
+  doSend(const Block& packet) final;
+
+  void
+  handleSend(const boost::system::error_code& error, size_t nBytesSent);
+
+  void
+  scheduleClosureWhenIdle();
+
+private:
+  boost::asio::ip::udp::socket& m_socket;
+  const boost::asio::ip::udp::endpoint m_remoteEndpoint;
+  const time::nanoseconds m_idleTimeout;
+  ndn::scheduler::ScopedEventId m_closeIfIdleEvent;
+  bool m_hasRecentlyReceived = false;
+  size_t m_nSendDrops = 0;
+};
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_SHARED_UDP_TRANSPORT_HPP
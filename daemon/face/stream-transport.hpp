@@ -27,24 +27,64 @@
 #define NFD_DAEMON_FACE_STREAM_TRANSPORT_HPP
 
 #include "transport.hpp"
+#include "receive-buffer-pool.hpp"
 #include "socket-utils.hpp"
 #include "common/global.hpp"
 
-#include <array>
-#include <queue>
+#include <deque>
+#include <numeric>
 
 #include <boost/asio/defer.hpp>
 #include <boost/asio/write.hpp>
 
 namespace nfd::face {
 
+/**
+ * \brief Counters of packets dropped from the send queue of a stream transport.
+ */
+class StreamSendQueueCounters
+{
+public:
+  /// number of queued packets dropped from the head of the send queue to make room for new ones
+  PacketCounter nHeadDrops;
+  /// number of packets dropped because they did not fit in the send queue
+  PacketCounter nTailDrops;
+};
+
+/**
+ * \brief Non-template base class of StreamTransport.
+ */
+class StreamTransportBase : public Transport
+{
+public:
+  const StreamSendQueueCounters&
+  getSendQueueCounters() const noexcept
+  {
+    return m_sendQueueCounters;
+  }
+
+public:
+  /// default capacity of the send queue, in octets
+  static constexpr size_t DEFAULT_SEND_QUEUE_CAPACITY = 1 << 20;
+
+protected:
+  StreamSendQueueCounters m_sendQueueCounters;
+};
+
 /**
  * \brief Implements a Transport for stream-based protocols.
  *
+ * Packets that cannot be written to the socket right away wait in a send queue, whose size
+ * is bounded by the send queue capacity. When a new packet does not fit, the oldest packets
+ * that are not being written are dropped to make room (head drop); if that is not enough,
+ * the new packet is dropped (tail drop). The time spent by the oldest packet in the queue
+ * is reported by getSendQueueSojournTime(), so that GenericLinkService can mark packets
+ * when a standing queue builds up.
+ *
  * \tparam Protocol a stream-based protocol in Boost.Asio
  */
 template<class Protocol>
-class StreamTransport : public Transport
+class StreamTransport : public StreamTransportBase
 {
 public:
   using protocol = Protocol;
@@ -57,9 +97,14 @@ public:
   explicit
   StreamTransport(typename protocol::socket&& socket);
 
+  ~StreamTransport() override;
+
   ssize_t
   getSendQueueLength() override;
 
+  time::nanoseconds
+  getSendQueueSojournTime() override;
+
 protected:
   void
   doClose() override;
@@ -99,30 +144,50 @@ protected:
   size_t
   getSendQueueBytes() const;
 
+public:
+  /// maximum number of queued packets written by a single scatter-gather write
+  static constexpr size_t MAX_SEND_BATCH_PACKETS = 64;
+  /// maximum number of bytes written by a single scatter-gather write, unless the first packet is larger
+  static constexpr size_t MAX_SEND_BATCH_BYTES = 1 << 18;
+
 protected:
   typename protocol::socket m_socket;
 
   NFD_LOG_MEMBER_DECL();
 
 private:
+  struct QueuedPacket
+  {
+    Block packet;
+    time::steady_clock::time_point enqueueTime;
+  };
+
   size_t m_sendQueueBytes = 0;
-  std::queue<Block> m_sendQueue;
+  std::deque<QueuedPacket> m_sendQueue;
+  /// number of packets at the front of m_sendQueue that belong to the pending write
+  size_t m_nSendInFlight = 0;
   size_t m_receiveBufferSize = 0;
-  std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
+  /// pooled receive buffer; large received packets reference it instead of being copied
+  shared_ptr<ndn::Buffer> m_receiveBuffer;
 };
 
 
 template<class T>
 StreamTransport<T>::StreamTransport(typename StreamTransport::protocol::socket&& socket)
   : m_socket(std::move(socket))
+  , m_receiveBuffer(getReceiveBufferPool().acquire())
 {
-  // No queue capacity is set because there is no theoretical limit to the size of m_sendQueue.
-  // Therefore, protecting against send queue overflows is less critical than in other transport
-  // types. Instead, we use the default threshold specified in the GenericLinkService options.
+  this->setSendQueueCapacity(DEFAULT_SEND_QUEUE_CAPACITY);
 
   startReceive();
 }
 
+template<class T>
+StreamTransport<T>::~StreamTransport()
+{
+  getReceiveBufferPool().release(std::move(m_receiveBuffer));
+}
+
 template<class T>
 ssize_t
 StreamTransport<T>::getSendQueueLength()
@@ -134,6 +199,16 @@ StreamTransport<T>::getSendQueueLength()
   return getSendQueueBytes() + std::max<ssize_t>(0, queueLength);
 }
 
+template<class T>
+time::nanoseconds
+StreamTransport<T>::getSendQueueSojournTime()
+{
+  if (m_sendQueue.empty())
+    return 0_ns;
+
+  return time::steady_clock::now() - m_sendQueue.front().enqueueTime;
+}
+
 template<class T>
 void
 StreamTransport<T>::doClose()
@@ -190,11 +265,28 @@ StreamTransport<T>::doSend(const Block& packet)
   if (getState() != TransportState::UP)
     return;
 
-  bool wasQueueEmpty = m_sendQueue.empty();
-  m_sendQueue.push(packet);
+  auto capacity = static_cast<size_t>(getSendQueueCapacity());
+  if (m_sendQueueBytes + packet.size() > capacity) {
+    // head drop: the oldest packets that are not being written are the most stale ones
+    while (m_sendQueue.size() > m_nSendInFlight && m_sendQueueBytes + packet.size() > capacity) {
+      auto victim = m_sendQueue.begin() + m_nSendInFlight;
+      m_sendQueueBytes -= victim->packet.size();
+      m_sendQueue.erase(victim);
+      ++m_sendQueueCounters.nHeadDrops;
+    }
+    if (m_sendQueueBytes + packet.size() > capacity) {
+      NFD_LOG_FACE_DEBUG("Send queue full, dropping " << packet.size() << " bytes");
+      ++m_sendQueueCounters.nTailDrops;
+      return;
+    }
+  }
+
+  m_sendQueue.push_back({packet, time::steady_clock::now()});
   m_sendQueueBytes += packet.size();
 
-  if (wasQueueEmpty)
+  // if a write is pending, the packet will be sent together with the
+  // rest of the queue when that write completes
+  if (m_nSendInFlight == 0)
     sendFromQueue();
 }
 
@@ -202,7 +294,23 @@ template<class T>
 void
 StreamTransport<T>::sendFromQueue()
 {
-  boost::asio::async_write(m_socket, boost::asio::buffer(m_sendQueue.front()),
+  BOOST_ASSERT(m_nSendInFlight == 0);
+  BOOST_ASSERT(!m_sendQueue.empty());
+
+  // coalesce as many queued packets as possible into a single scatter-gather write
+  std::vector<boost::asio::const_buffer> buffers;
+  buffers.reserve(std::min(m_sendQueue.size(), MAX_SEND_BATCH_PACKETS));
+  size_t nBytes = 0;
+  for (const auto& queued : m_sendQueue) {
+    if (buffers.size() == MAX_SEND_BATCH_PACKETS ||
+        (!buffers.empty() && nBytes + queued.packet.size() > MAX_SEND_BATCH_BYTES))
+      break;
+    buffers.push_back(boost::asio::buffer(queued.packet));
+    nBytes += queued.packet.size();
+  }
+  m_nSendInFlight = buffers.size();
+
+  boost::asio::async_write(m_socket, std::move(buffers),
                            [this] (auto&&... args) { this->handleSend(std::forward<decltype(args)>(args)...); });
 }
 
@@ -214,12 +322,15 @@ StreamTransport<T>::handleSend(const boost::system::error_code& error,
   if (error)
     return processErrorCode(error);
 
-  NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
+  NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes in " << m_nSendInFlight << " packets");
 
-  BOOST_ASSERT(!m_sendQueue.empty());
-  BOOST_ASSERT(m_sendQueue.front().size() == nBytesSent);
+  BOOST_ASSERT(m_nSendInFlight > 0);
+  BOOST_ASSERT(m_nSendInFlight <= m_sendQueue.size());
+  BOOST_ASSERT(std::accumulate(m_sendQueue.begin(), m_sendQueue.begin() + m_nSendInFlight, size_t(0),
+                               [] (size_t sum, const auto& q) { return sum + q.packet.size(); }) == nBytesSent);
   m_sendQueueBytes -= nBytesSent;
-  m_sendQueue.pop();
+  m_sendQueue.erase(m_sendQueue.begin(), m_sendQueue.begin() + m_nSendInFlight);
+  m_nSendInFlight = 0;
 
   if (!m_sendQueue.empty())
     sendFromQueue();
@@ -231,8 +342,8 @@ StreamTransport<T>::startReceive()
 {
   BOOST_ASSERT(getState() == TransportState::UP);
 
-  m_socket.async_receive(boost::asio::buffer(m_receiveBuffer.data() + m_receiveBufferSize,
-                                             m_receiveBuffer.size() - m_receiveBufferSize),
+  m_socket.async_receive(boost::asio::buffer(m_receiveBuffer->data() + m_receiveBufferSize,
+                                             m_receiveBuffer->size() - m_receiveBufferSize),
                          [this] (auto&&... args) { this->handleReceive(std::forward<decltype(args)>(args)...); });
 }
 
@@ -247,9 +358,10 @@ StreamTransport<T>::handleReceive(const boost::system::error_code& error,
   NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes");
 
   m_receiveBufferSize += nBytesReceived;
-  auto unparsedBytes = ndn::make_span(m_receiveBuffer).first(m_receiveBufferSize);
+  auto& pool = getReceiveBufferPool();
+  auto unparsedBytes = ndn::make_span(*m_receiveBuffer).first(m_receiveBufferSize);
   while (!unparsedBytes.empty()) {
-    auto [isOk, element] = Block::fromBuffer(unparsedBytes);
+    auto [isOk, element] = pool.decode(m_receiveBuffer, unparsedBytes);
     if (!isOk)
       break;
 
@@ -257,16 +369,24 @@ StreamTransport<T>::handleReceive(const boost::system::error_code& error,
     this->receive(element);
   }
 
-  if (unparsedBytes.empty()) {
+  if (m_receiveBuffer.use_count() > 1) {
+    // received packets reference the receive buffer, so it cannot be overwritten:
+    // continue with a fresh buffer and move the remaining unparsed bytes there
+    auto rxBuffer = pool.acquire();
+    std::copy(unparsedBytes.begin(), unparsedBytes.end(), rxBuffer->begin());
+    m_receiveBufferSize = unparsedBytes.size();
+    pool.release(std::exchange(m_receiveBuffer, std::move(rxBuffer)));
+  }
+  else if (unparsedBytes.empty()) {
     // nothing left in the receive buffer
     m_receiveBufferSize = 0;
   }
-  else if (unparsedBytes.data() != m_receiveBuffer.data()) {
+  else if (unparsedBytes.data() != m_receiveBuffer->data()) {
     // move remaining unparsed bytes to the beginning of the receive buffer
-    std::copy(unparsedBytes.begin(), unparsedBytes.end(), m_receiveBuffer.begin());
+    std::copy(unparsedBytes.begin(), unparsedBytes.end(), m_receiveBuffer->begin());
     m_receiveBufferSize = unparsedBytes.size();
   }
-  else if (unparsedBytes.size() == m_receiveBuffer.size()) {
+  else if (unparsedBytes.size() == m_receiveBuffer->size()) {
     NFD_LOG_FACE_ERROR("Failed to parse incoming packet or packet too large to process");
     this->setState(TransportState::FAILED);
     doClose();
@@ -318,9 +438,10 @@ template<class T>
 void
 StreamTransport<T>::resetSendQueue()
 {
-  std::queue<Block> emptyQueue;
+  std::deque<QueuedPacket> emptyQueue;
   std::swap(emptyQueue, m_sendQueue);
   m_sendQueueBytes = 0;
+  m_nSendInFlight = 0;
 }
 
 template<class T>
@@ -328,6 +328,20 @@ public: // dynamic properties
     return QUEUE_UNSUPPORTED;
   }
 
+  /**
+   * \brief Returns how long the packet at the head of the send queue has been waiting.
+   *
+   * Only transports that keep their own send queue can report the sojourn time; this is
+   * zero when the queue is empty.
+   *
+   * \return A negative duration if the transport does not support sojourn time retrieval.
+   */
+  virtual time::nanoseconds
+  getSendQueueSojournTime()
+  {
+    return time::nanoseconds(QUEUE_UNSUPPORTED);
+  }
+
 protected: // upper interface to be invoked by subclass
   /**
    * \brief Pass a received link-layer packet to the upper layer for further processing.
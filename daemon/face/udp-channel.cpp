@@ -26,6 +26,8 @@
 #include "udp-channel.hpp"
 #include "face.hpp"
 #include "generic-link-service.hpp"
+#include "shared-udp-transport.hpp"
+#include "udp-rx-thread.hpp"
 #include "unicast-udp-transport.hpp"
 #include "common/global.hpp"
 
@@ -40,11 +42,17 @@ NFD_LOG_INIT(UdpChannel);
 UdpChannel::UdpChannel(const udp::Endpoint& localEndpoint,
                        time::nanoseconds idleTimeout,
                        bool wantCongestionMarking,
-                       size_t defaultMtu)
+                       size_t defaultMtu,
+                       size_t batchSize,
+                       bool wantSharedSocket,
+                       size_t nRxThreads)
   : m_localEndpoint(localEndpoint)
   , m_socket(getGlobalIoService())
   , m_idleFaceTimeout(idleTimeout)
   , m_wantCongestionMarking(wantCongestionMarking)
+  , m_batchSize(batchSize)
+  , m_wantSharedSocket(wantSharedSocket)
+  , m_nRxThreads(wantSharedSocket ? nRxThreads : 0)
 {
   setUri(FaceUri(m_localEndpoint));
   setDefaultMtu(defaultMtu);
@@ -57,6 +65,13 @@ UdpChannel::connect(const udp::Endpoint& remoteEndpoint,
                     const FaceCreatedCallback& onFaceCreated,
                     const FaceCreationFailedCallback& onConnectFailed)
 {
+  if (m_wantSharedSocket && !isListening()) {
+    NFD_LOG_CHAN_DEBUG("Face creation for " << remoteEndpoint << " failed: channel is not listening");
+    if (onConnectFailed)
+      onConnectFailed(504, "Face creation failed: channel is not listening");
+    return;
+  }
+
   shared_ptr<Face> face;
   try {
     face = createFace(remoteEndpoint, params).second;
@@ -84,10 +99,26 @@ UdpChannel::listen(const FaceCreatedCallback& onFaceCreated,
 
   m_socket.open(m_localEndpoint.protocol());
   m_socket.set_option(boost::asio::socket_base::reuse_address(true));
+  if (m_nRxThreads > 0) {
+    UdpRxThread::setReusePort(m_socket);
+  }
   if (m_localEndpoint.address().is_v6()) {
     m_socket.set_option(ip::v6_only(true));
   }
   m_socket.bind(m_localEndpoint);
+  if (m_wantSharedSocket) {
+    // SharedUdpTransport sends synchronously and must never block on a full send buffer
+    m_socket.non_blocking(true);
+  }
+
+  for (size_t i = 0; i < m_nRxThreads; ++i) {
+    auto rx = std::make_shared<UdpRxThread>(m_localEndpoint,
+      [=] (const udp::Endpoint& sender, const Block& element) {
+        handleRxThreadDatagram(sender, element, onFaceCreated, onFaceCreationFailed);
+      });
+    rx->start();
+    m_rxThreads.push_back(std::move(rx));
+  }
 
   waitForNewPeer(onFaceCreated, onFaceCreationFailed);
   NFD_LOG_CHAN_DEBUG("Started listening");
@@ -117,6 +148,17 @@ UdpChannel::handleNewPeer(const boost::system::error_code& error,
     return;
   }
 
+  if (m_wantSharedSocket) {
+    // fast path: demultiplex the datagram to an existing face
+    auto it = m_channelFaces.find(m_remoteEndpoint);
+    if (it != m_channelFaces.end()) {
+      auto* transport = static_cast<SharedUdpTransport*>(it->second->getTransport());
+      transport->receiveDatagram(ndn::span(m_receiveBuffer).first(nBytesReceived));
+      waitForNewPeer(onFaceCreated, onReceiveFailed);
+      return;
+    }
+  }
+
   NFD_LOG_CHAN_TRACE("New peer " << m_remoteEndpoint);
 
   bool isCreated = false;
@@ -140,12 +182,48 @@ UdpChannel::handleNewPeer(const boost::system::error_code& error,
     NFD_LOG_CHAN_DEBUG("Received datagram for existing face");
 
   // dispatch the datagram to the face for processing
-  auto* transport = static_cast<UnicastUdpTransport*>(face->getTransport());
-  transport->receiveDatagram(ndn::span(m_receiveBuffer).first(nBytesReceived), error);
+  auto buffer = ndn::span(m_receiveBuffer).first(nBytesReceived);
+  if (m_wantSharedSocket) {
+    static_cast<SharedUdpTransport*>(face->getTransport())->receiveDatagram(buffer);
+  }
+  else {
+    static_cast<UnicastUdpTransport*>(face->getTransport())->receiveDatagram(buffer, error);
+  }
 
   waitForNewPeer(onFaceCreated, onReceiveFailed);
 }
 
+void
+UdpChannel::handleRxThreadDatagram(const udp::Endpoint& sender,
+                                   const Block& element,
+                                   const FaceCreatedCallback& onFaceCreated,
+                                   const FaceCreationFailedCallback& onReceiveFailed)
+{
+  shared_ptr<Face> face;
+  auto it = m_channelFaces.find(sender);
+  if (it != m_channelFaces.end()) {
+    face = it->second;
+  }
+  else {
+    NFD_LOG_CHAN_TRACE("New peer " << sender);
+    try {
+      FaceParams params;
+      params.persistency = ndn::nfd::FACE_PERSISTENCY_ON_DEMAND;
+      params.mtu = getDefaultMtu();
+      face = createFace(sender, params).second;
+    }
+    catch (const boost::system::system_error& e) {
+      NFD_LOG_CHAN_DEBUG("Face creation for " << sender << " failed: " << e.what());
+      if (onReceiveFailed)
+        onReceiveFailed(504, "Face creation failed: "s + e.what());
+      return;
+    }
+    onFaceCreated(face);
+  }
+
+  static_cast<SharedUdpTransport*>(face->getTransport())->receiveElement(element);
+}
+
 std::pair<bool, shared_ptr<Face>>
 UdpChannel::createFace(const udp::Endpoint& remoteEndpoint,
                        const FaceParams& params)
@@ -158,11 +236,6 @@ UdpChannel::createFace(const udp::Endpoint& remoteEndpoint,
   }
 
   // else, create a new face
-  ip::udp::socket socket(getGlobalIoService(), m_localEndpoint.protocol());
-  socket.set_option(boost::asio::socket_base::reuse_address(true));
-  socket.bind(m_localEndpoint);
-  socket.connect(remoteEndpoint);
-
   GenericLinkService::Options options;
   options.allowFragmentation = true;
   options.allowReassembly = true;
@@ -185,9 +258,21 @@ UdpChannel::createFace(const udp::Endpoint& remoteEndpoint,
 
   options.overrideMtu = params.mtu.value_or(getDefaultMtu());
 
+  unique_ptr<Transport> transport;
+  if (m_wantSharedSocket) {
+    transport = make_unique<SharedUdpTransport>(m_socket, remoteEndpoint, params.persistency,
+                                                m_idleFaceTimeout);
+  }
+  else {
+    ip::udp::socket socket(getGlobalIoService(), m_localEndpoint.protocol());
+    socket.set_option(boost::asio::socket_base::reuse_address(true));
+    socket.bind(m_localEndpoint);
+    socket.connect(remoteEndpoint);
+    transport = make_unique<UnicastUdpTransport>(std::move(socket), params.persistency,
+                                                 m_idleFaceTimeout, m_batchSize);
+  }
+
   auto linkService = make_unique<GenericLinkService>(options);
-  auto transport = make_unique<UnicastUdpTransport>(std::move(socket), params.persistency,
-                                                    m_idleFaceTimeout);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
   face->setChannel(weak_from_this());
 
@@ -30,10 +30,13 @@
 #include "udp-protocol.hpp"
 
 #include <array>
-#include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace nfd::face {
 
+class UdpRxThread;
+
 /**
  * \brief Class implementing a UDP-based channel to create faces.
  */
@@ -45,11 +48,24 @@ public:
    *
    * To enable the creation of faces upon incoming connections, one needs to
    * explicitly call listen(). The created socket is bound to \p localEndpoint.
+   * Faces created by this channel use batched datagram I/O if \p batchSize is greater than 1.
+   *
+   * If \p wantSharedSocket is true, all unicast faces of the channel send and receive through
+   * the listening socket instead of opening one connected socket each. Incoming datagrams are
+   * demultiplexed by remote endpoint. In this mode, faces can be created only while the channel
+   * is listening, and \p batchSize is ignored.
+   *
+   * If \p wantSharedSocket is true and \p nRxThreads is positive, listen() additionally opens
+   * \p nRxThreads sockets with `SO_REUSEPORT` on the same endpoint, each read by its own
+   * I/O thread (see UdpRxThread). Otherwise, \p nRxThreads is ignored.
    */
   UdpChannel(const udp::Endpoint& localEndpoint,
              time::nanoseconds idleTimeout,
              bool wantCongestionMarking,
-             size_t defaultMtu);
+             size_t defaultMtu,
+             size_t batchSize = 1,
+             bool wantSharedSocket = false,
+             size_t nRxThreads = 0);
 
   bool
   isListening() const final
@@ -57,6 +73,15 @@ public:
     return m_socket.is_open();
   }
 
+  /**
+   * \brief Whether the unicast faces of this channel share the listening socket.
+   */
+  bool
+  hasSharedSocket() const noexcept
+  {
+    return m_wantSharedSocket;
+  }
+
   size_t
   size() const final
   {
@@ -98,6 +123,12 @@ private:
                 const FaceCreatedCallback& onFaceCreated,
                 const FaceCreationFailedCallback& onReceiveFailed);
 
+  void
+  handleRxThreadDatagram(const udp::Endpoint& sender,
+                         const Block& element,
+                         const FaceCreatedCallback& onFaceCreated,
+                         const FaceCreationFailedCallback& onReceiveFailed);
+
   std::pair<bool, shared_ptr<Face>>
   createFace(const udp::Endpoint& remoteEndpoint,
              const FaceParams& params);
@@ -107,9 +138,13 @@ private:
   udp::Endpoint m_remoteEndpoint; ///< The latest peer that started communicating with us
   boost::asio::ip::udp::socket m_socket; ///< Socket used to "accept" new peers
   std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
-  std::map<udp::Endpoint, shared_ptr<Face>> m_channelFaces;
+  std::unordered_map<udp::Endpoint, shared_ptr<Face>, udp::EndpointHash> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
   const bool m_wantCongestionMarking;
+  const size_t m_batchSize;
+  const bool m_wantSharedSocket;
+  const size_t m_nRxThreads;
+  std::vector<shared_ptr<UdpRxThread>> m_rxThreads;
 };
 
 } // namespace nfd::face
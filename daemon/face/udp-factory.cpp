@@ -41,6 +41,9 @@ namespace net = ndn::net;
 NFD_LOG_INIT(UdpFactory);
 NFD_REGISTER_PROTOCOL_FACTORY(UdpFactory);
 
+constexpr size_t MAX_BATCH_SIZE = 1024;
+constexpr size_t MAX_RX_THREADS = 64;
+
 const std::string&
 UdpFactory::getId() noexcept
 {
@@ -68,6 +71,9 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   //   enable_v6 yes
   //   idle_timeout 600
   //   unicast_mtu 8800
+  //   batch_size 1
+  //   shared_socket no
+  //   rx_threads 0
   //   mcast yes
   //   mcast_group 224.0.23.170
   //   mcast_port 56363
@@ -91,6 +97,9 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   bool enableV6 = false;
   uint32_t idleTimeout = 600;
   size_t unicastMtu = ndn::MAX_NDN_PACKET_SIZE;
+  size_t batchSize = 1;
+  bool wantSharedSocket = false;
+  size_t nRxThreads = 0;
   MulticastConfig mcastConfig;
 
   if (configSection) {
@@ -121,6 +130,17 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
         ConfigFile::checkRange(unicastMtu, static_cast<size_t>(MIN_MTU), ndn::MAX_NDN_PACKET_SIZE,
                                "unicast_mtu", "face_system.udp");
       }
+      else if (key == "batch_size") {
+        batchSize = ConfigFile::parseNumber<size_t>(pair, "face_system.udp");
+        ConfigFile::checkRange(batchSize, size_t{1}, MAX_BATCH_SIZE, "batch_size", "face_system.udp");
+      }
+      else if (key == "shared_socket") {
+        wantSharedSocket = ConfigFile::parseYesNo(pair, "face_system.udp");
+      }
+      else if (key == "rx_threads") {
+        nRxThreads = ConfigFile::parseNumber<size_t>(pair, "face_system.udp");
+        ConfigFile::checkRange(nRxThreads, size_t{0}, MAX_RX_THREADS, "rx_threads", "face_system.udp");
+      }
       else if (key == "keep_alive_interval") {
         // ignored
       }
@@ -174,6 +194,17 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
       }
     }
 
+    if (wantSharedSocket && !wantListen) {
+      NDN_THROW(ConfigFile::Error("face_system.udp.shared_socket requires face_system.udp.listen"));
+    }
+    if (wantSharedSocket && batchSize > 1) {
+      NDN_THROW(ConfigFile::Error("face_system.udp.batch_size cannot be greater than 1 "
+                                  "with face_system.udp.shared_socket"));
+    }
+    if (nRxThreads > 0 && !wantSharedSocket) {
+      NDN_THROW(ConfigFile::Error("face_system.udp.rx_threads requires face_system.udp.shared_socket"));
+    }
+
     if (!enableV4 && !enableV6 && !mcastConfig.isEnabled) {
       NDN_THROW(ConfigFile::Error(
         "IPv4 and IPv6 UDP channels and UDP multicast have been disabled. "
@@ -186,10 +217,22 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   }
 
   m_defaultUnicastMtu = unicastMtu;
+  m_batchSize = batchSize;
+  m_wantSharedSocket = wantSharedSocket;
+#ifdef __linux__
+  m_nRxThreads = nRxThreads;
+#else
+  if (nRxThreads > 0) {
+    NFD_LOG_WARN("UDP receive threads are not supported on this platform");
+  }
+#endif
 
   if (enableV4) {
     udp::Endpoint endpoint(ip::udp::v4(), port);
     shared_ptr<UdpChannel> v4Channel = this->createChannel(endpoint, time::seconds(idleTimeout));
+    if (v4Channel->hasSharedSocket() != wantSharedSocket) {
+      NFD_LOG_WARN("Cannot change shared_socket setting on existing UDP channel");
+    }
     if (wantListen && !v4Channel->isListening()) {
       v4Channel->listen(this->addFace, nullptr);
     }
@@ -203,6 +246,9 @@ UdpFactory::doProcessConfig(OptionalConfigSection configSection,
   if (enableV6) {
     udp::Endpoint endpoint(ip::udp::v6(), port);
     shared_ptr<UdpChannel> v6Channel = this->createChannel(endpoint, time::seconds(idleTimeout));
+    if (v6Channel->hasSharedSocket() != wantSharedSocket) {
+      NFD_LOG_WARN("Cannot change shared_socket setting on existing UDP channel");
+    }
     if (wantListen && !v6Channel->isListening()) {
       v6Channel->listen(this->addFace, nullptr);
     }
@@ -313,7 +359,8 @@ UdpFactory::createChannel(const udp::Endpoint& localEndpoint,
   }
 
   auto channel = std::make_shared<UdpChannel>(localEndpoint, idleTimeout,
-                                              m_wantCongestionMarking, m_defaultUnicastMtu);
+                                              m_wantCongestionMarking, m_defaultUnicastMtu,
+                                              m_batchSize, m_wantSharedSocket, m_nRxThreads);
   m_channels[localEndpoint] = channel;
   return channel;
 }
@@ -367,7 +414,7 @@ UdpFactory::createMulticastFace(const net::NetworkInterface& netif,
   options.allowCongestionMarking = m_wantCongestionMarking;
   auto linkService = make_unique<GenericLinkService>(options);
   auto transport = make_unique<MulticastUdpTransport>(mcastEp, std::move(rxSock), std::move(txSock),
-                                                      m_mcastConfig.linkType);
+                                                      m_mcastConfig.linkType, m_batchSize);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   m_mcastFaces[localEp] = face;
@@ -125,6 +125,9 @@ private:
 private:
   bool m_wantCongestionMarking = false;
   size_t m_defaultUnicastMtu = ndn::MAX_NDN_PACKET_SIZE;
+  size_t m_batchSize = 1;
+  bool m_wantSharedSocket = false;
+  size_t m_nRxThreads = 0;
   std::map<udp::Endpoint, shared_ptr<UdpChannel>> m_channels;
 
   struct MulticastConfig
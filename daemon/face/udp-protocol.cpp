@@ -25,7 +25,9 @@
 
 #include "udp-protocol.hpp"
 
+#include <functional>
 #include <limits>
+#include <string_view>
 
 namespace nfd::udp {
 
@@ -44,4 +46,22 @@ computeMtu(const Endpoint& localEndpoint)
   return mtu;
 }
 
+size_t
+EndpointHash::operator()(const Endpoint& ep) const noexcept
+{
+  size_t h = 0;
+  const auto& addr = ep.address();
+  if (addr.is_v4()) {
+    h = std::hash<uint32_t>{}(addr.to_v4().to_uint());
+  }
+  else {
+    const auto& v6 = addr.to_v6();
+    auto bytes = v6.to_bytes();
+    h = std::hash<std::string_view>{}({reinterpret_cast<const char*>(bytes.data()), bytes.size()});
+    h ^= v6.scope_id() + 0x9E3779B9 + (h << 6) + (h >> 2);
+  }
+  h ^= ep.port() + 0x9E3779B9 + (h << 6) + (h >> 2);
+  return h;
+}
+
 } // namespace nfd::udp
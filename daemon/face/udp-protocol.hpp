@@ -40,6 +40,15 @@ using Endpoint = boost::asio::ip::udp::endpoint;
 ssize_t
 computeMtu(const Endpoint& localEndpoint);
 
+/**
+ * \brief Hash function for UDP endpoints, for use in unordered containers.
+ */
+struct EndpointHash
+{
+  size_t
+  operator()(const Endpoint& ep) const noexcept;
+};
+
 /**
  * \brief Returns the default IPv4 multicast group: `224.0.23.170:56363`
  */
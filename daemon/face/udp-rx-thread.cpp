@@ -0,0 +1,152 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "udp-rx-thread.hpp"
+#include "common/global.hpp"
+
+#include <boost/asio/ip/v6_only.hpp>
+#include <boost/asio/post.hpp>
+
+#ifdef __linux__
+#include <cerrno>       // for errno
+#include <sys/socket.h> // for setsockopt() and SO_REUSEPORT
+#endif
+
+namespace nfd::face {
+
+NFD_LOG_INIT(UdpRxThread);
+
+UdpRxThread::UdpRxThread(const udp::Endpoint& localEndpoint, DatagramCallback onDatagram,
+                         size_t queueCapacity)
+  : m_mainIo(getGlobalIoService())
+  , m_socket(m_io, localEndpoint.protocol())
+  , m_queue(queueCapacity)
+  , m_onDatagram(std::move(onDatagram))
+{
+  setReusePort(m_socket);
+  if (localEndpoint.address().is_v6()) {
+    m_socket.set_option(boost::asio::ip::v6_only(true));
+  }
+  m_socket.bind(localEndpoint);
+}
+
+UdpRxThread::~UdpRxThread()
+{
+  m_io.stop();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+void
+UdpRxThread::start()
+{
+  BOOST_ASSERT(!m_thread.joinable());
+  BOOST_ASSERT(!weak_from_this().expired());
+
+  startReceive();
+  m_thread = std::thread([this] { m_io.run(); });
+  NFD_LOG_DEBUG("[" << m_socket.local_endpoint() << "] Started receive thread");
+}
+
+void
+UdpRxThread::setReusePort(boost::asio::ip::udp::socket& socket)
+{
+#ifdef __linux__
+  const int value = 1;
+  if (::setsockopt(socket.native_handle(), SOL_SOCKET, SO_REUSEPORT, &value, sizeof(value)) < 0) {
+    NDN_THROW_NO_STACK(boost::system::system_error(errno, boost::system::system_category(),
+                                                   "setsockopt(SO_REUSEPORT)"));
+  }
+#else
+  NDN_THROW_NO_STACK(boost::system::system_error(boost::asio::error::operation_not_supported,
+                                                 "SO_REUSEPORT"));
+#endif
+}
+
+void
+UdpRxThread::startReceive()
+{
+  m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
+                              [this] (auto&&... args) {
+                                this->handleReceive(std::forward<decltype(args)>(args)...);
+                              });
+}
+
+void
+UdpRxThread::handleReceive(const boost::system::error_code& error, size_t nBytesReceived)
+{
+  if (error) {
+    if (error == boost::asio::error::operation_aborted) {
+      return;
+    }
+    NFD_LOG_DEBUG("Receive failed: " << error.message());
+    return startReceive();
+  }
+
+  auto buffer = ndn::span(m_receiveBuffer).first(nBytesReceived);
+  auto [isOk, element] = Block::fromBuffer(buffer);
+  if (!isOk || element.size() != buffer.size()) {
+    NFD_LOG_DEBUG("Dropping malformed datagram from " << m_sender);
+    return startReceive();
+  }
+
+  try {
+    // decode the sub-elements here as well, instead of on the forwarding thread
+    element.parse();
+  }
+  catch (const tlv::Error&) {
+    // leave the error to be reported by the link service
+  }
+
+  if (!m_queue.tryPush(Datagram{m_sender, std::move(element)})) {
+    m_nDropped.fetch_add(1, std::memory_order_relaxed);
+    return startReceive();
+  }
+
+  if (!m_isDrainPending.exchange(true, std::memory_order_acq_rel)) {
+    boost::asio::post(m_mainIo, [self = weak_from_this()] {
+      if (auto rx = self.lock(); rx != nullptr) {
+        rx->drainQueue();
+      }
+    });
+  }
+
+  startReceive();
+}
+
+void
+UdpRxThread::drainQueue()
+{
+  // clear the flag before draining, so that a datagram pushed after the last
+  // tryPop() below always schedules another drain
+  m_isDrainPending.store(false, std::memory_order_release);
+
+  while (auto datagram = m_queue.tryPop()) {
+    m_onDatagram(datagram->sender, datagram->element);
+  }
+}
+
+} // namespace nfd::face
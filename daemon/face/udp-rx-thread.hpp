@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_UDP_RX_THREAD_HPP
+#define NFD_DAEMON_FACE_UDP_RX_THREAD_HPP
+
+#include "face-common.hpp"
+#include "common/spsc-queue.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <array>
+#include <atomic>
+#include <thread>
+
+namespace nfd::face {
+
+/**
+ * \brief Receives UDP datagrams on an `SO_REUSEPORT` socket in a dedicated I/O thread.
+ *
+ * The receiver binds its own socket to a local endpoint shared with other sockets that have
+ * `SO_REUSEPORT` set, so that the kernel spreads incoming datagrams among them. Its thread
+ * decodes the outer TLV element of each datagram, and hands it over to the thread that
+ * created the receiver through a single-producer single-consumer queue. The callback is
+ * always invoked on the io_context of the creating thread.
+ *
+ * The receiver must be owned by a `shared_ptr`, and start() must be called once the
+ * `shared_ptr` has been created.
+ *
+ * \note Only supported on Linux, where `SO_REUSEPORT` balances datagrams among sockets.
+ */
+class UdpRxThread : noncopyable, public std::enable_shared_from_this<UdpRxThread>
+{
+public:
+  using DatagramCallback = std::function<void(const udp::Endpoint& sender, const Block& element)>;
+
+  /**
+   * \brief Opens and binds the socket.
+   * \param localEndpoint the local endpoint to bind to
+   * \param onDatagram callback invoked on the creating thread for every well-formed datagram
+   * \param queueCapacity capacity of the queue toward the creating thread; datagrams that
+   *                      arrive while the queue is full are dropped
+   * \throw boost::system::system_error the socket cannot be opened or bound
+   */
+  UdpRxThread(const udp::Endpoint& localEndpoint, DatagramCallback onDatagram,
+              size_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
+
+  /**
+   * \brief Stops the I/O thread and closes the socket.
+   *
+   * Datagrams that are still in the queue are discarded.
+   */
+  ~UdpRxThread();
+
+  /**
+   * \brief Starts receiving datagrams in the I/O thread.
+   */
+  void
+  start();
+
+  /**
+   * \brief Returns the number of datagrams dropped because the queue was full.
+   */
+  uint64_t
+  getNDropped() const noexcept
+  {
+    return m_nDropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Sets `SO_REUSEPORT` on \p socket.
+   * \throw boost::system::system_error the option cannot be set
+   */
+  static void
+  setReusePort(boost::asio::ip::udp::socket& socket);
+
+public:
+  static constexpr size_t DEFAULT_QUEUE_CAPACITY = 4096;
+
+private: // I/O thread
+  void
+  startReceive();
+
+  void
+  handleReceive(const boost::system::error_code& error, size_t nBytesReceived);
+
+private: // creating thread
+  void
+  drainQueue();
+
+private:
+  struct Datagram
+  {
+    udp::Endpoint sender;
+    Block element;
+  };
+
+  boost::asio::io_context& m_mainIo;
+  boost::asio::io_context m_io;
+  boost::asio::ip::udp::socket m_socket;
+  udp::Endpoint m_sender;
+  std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
+
+  SpscQueue<Datagram> m_queue;
+  std::atomic<bool> m_isDrainPending{false};
+  std::atomic<uint64_t> m_nDropped{0};
+  DatagramCallback m_onDatagram;
+
+  std::thread m_thread;
+};
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_UDP_RX_THREAD_HPP
@@ -42,8 +42,9 @@ NFD_LOG_MEMBER_INIT_SPECIALIZED((DatagramTransport<ip::udp, Unicast>), UnicastUd
 
 UnicastUdpTransport::UnicastUdpTransport(ip::udp::socket&& socket,
                                          ndn::nfd::FacePersistency persistency,
-                                         time::nanoseconds idleTimeout)
-  : DatagramTransport(std::move(socket))
+                                         time::nanoseconds idleTimeout,
+                                         size_t batchSize)
+  : DatagramTransport(std::move(socket), batchSize)
   , m_idleTimeout(idleTimeout)
 {
   this->setLocalUri(FaceUri(m_socket.local_endpoint()));
@@ -31,6 +31,7 @@
 #include "strategy.hpp"
 #include "common/global.hpp"
 #include "common/logger.hpp"
+#include "common/timer-wheel.hpp"
 #include "table/cleanup.hpp"
 
 #include <ndn-cxx/lp/pit-token.hpp>
@@ -176,7 +177,7 @@ Forwarder::onInterestLoop(const Interest& interest, const FaceEndpoint& ingress)
                 << " nonce=" << interest.getNonce());
 
   // leave loop handling up to the strategy (e.g., whether to reply with a Nack)
-  m_strategyChoice.findEffectiveStrategy(interest.getName()).onInterestLoop(interest, ingress);
+  m_strategyChoice.findEffectiveStrategy(interest).onInterestLoop(interest, ingress);
 }
 
 void
@@ -535,7 +536,7 @@ void
 Forwarder::onDroppedInterest(const Interest& interest, Face& egress)
 {
   NFD_LOG_DEBUG("onDroppedInterest out=" << egress.getId() << " interest=" << interest.getName());
-  m_strategyChoice.findEffectiveStrategy(interest.getName()).onDroppedInterest(interest, egress);
+  m_strategyChoice.findEffectiveStrategy(interest).onDroppedInterest(interest, egress);
 }
 
 void
@@ -567,8 +568,16 @@ Forwarder::setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::millisec
   BOOST_ASSERT(pitEntry);
   duration = std::max(duration, 0_ms);
 
-  pitEntry->expiryTimer.cancel();
-  pitEntry->expiryTimer = getScheduler().schedule(duration, [=] { onInterestFinalize(pitEntry); });
+  if (!pitEntry->expiryTimer.hasCallback()) {
+    // The timer is owned by the PIT entry, so it must not hold a strong reference to the entry.
+    // The entry is kept alive while finalizing it, even though it is erased from the PIT.
+    pitEntry->expiryTimer.setCallback([this, weakEntry = weak_ptr<pit::Entry>(pitEntry)] {
+      if (auto entry = weakEntry.lock(); entry != nullptr) {
+        onInterestFinalize(entry);
+      }
+    });
+  }
+  getTimerWheel().schedule(pitEntry->expiryTimer, duration);
 }
 
 void
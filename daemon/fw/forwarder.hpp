@@ -159,7 +159,8 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
                     const shared_ptr<pit::Entry>& pitEntry, const Data& data);
 
   /** \brief Outgoing Interest pipeline.
-   *  \return A pointer to the out-record created or nullptr if the Interest was dropped
+   *  \return A pointer to the out-record created or nullptr if the Interest was dropped.
+   *          The pointer is invalidated when another out-record is inserted or deleted.
    */
   NFD_VIRTUAL_WITH_TESTS pit::OutRecord*
   onOutgoingInterest(const Interest& interest, Face& egress,
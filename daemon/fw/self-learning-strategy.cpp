@@ -239,7 +239,7 @@ SelfLearningStrategy::addRoute(const shared_ptr<pit::Entry>& pitEntry, const Fac
                                const Data& data, const ndn::PrefixAnnouncement& pa)
 {
   boost::asio::post(getRibIoService(),
-    [pitEntryWeak = weak_ptr<pit::Entry>{pitEntry}, inFaceId = inFace.getId(), data, pa] {
+    [inFaceId = inFace.getId(), data, pa] {
       rib::Service::get().getRibManager().slAnnounce(pa, inFaceId, ROUTE_RENEW_LIFETIME,
         [] (RibManager::SlAnnounceResult res) {
           NFD_LOG_DEBUG("Add route via PrefixAnnouncement with result=" << res);
@@ -297,7 +297,8 @@ protected: // actions
    * \param interest the Interest packet
    * \param egress face through which to send out the Interest
    * \param pitEntry the PIT entry
-   * \return A pointer to the out-record created or nullptr if the Interest was dropped
+   * \return A pointer to the out-record created or nullptr if the Interest was dropped.
+   *         The pointer is invalidated when another out-record is inserted or deleted.
    */
   NFD_VIRTUAL_WITH_TESTS pit::OutRecord*
   sendInterest(const Interest& interest, Face& egress, const shared_ptr<pit::Entry>& pitEntry);
@@ -119,7 +119,8 @@ public:
     std::mutex m;
     std::condition_variable cv;
 
-    std::thread ribThread([configFile = m_configFile, &retval, &ribIo, mainIo, &cv, &m] {
+    std::thread ribThread([configFile = m_configFile, fibUpdateChannel = m_nfd.getFibUpdateChannel(),
+                           &retval, &ribIo, mainIo, &cv, &m] {
       {
         std::lock_guard<std::mutex> lock(m);
         ribIo = &getGlobalIoService();
@@ -131,7 +132,7 @@ public:
       try {
         ndn::KeyChain ribKeyChain;
         // must be created inside a separate thread
-        rib::Service ribService(configFile, ribKeyChain);
+        rib::Service ribService(configFile, ribKeyChain, fibUpdateChannel);
         getGlobalIoService().run(); // ribIo is not thread-safe to use here
       }
       catch (const std::exception& e) {
@@ -24,6 +24,7 @@
  */
 
 #include "cs-manager.hpp"
+#include "status-tlv.hpp"
 #include "fw/forwarder-counters.hpp"
 #include "table/cs.hpp"
 
@@ -114,7 +115,13 @@ CsManager::serveInfo(ndn::mgmt::StatusDatasetContext& context) const
   info.setNHits(m_fwCounters.nCsHits);
   info.setNMisses(m_fwCounters.nCsMisses);
 
-  context.append(info.wireEncode());
+  Block wire = info.wireEncode();
+  wire.parse();
+  wire.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::CsMaxBytes, m_cs.getLimitBytes()));
+  wire.push_back(ndn::encoding::makeNonNegativeIntegerBlock(tlv::CsNBytes, m_cs.getNBytes()));
+  wire.encode();
+
+  context.append(wire);
   context.end();
 }
 
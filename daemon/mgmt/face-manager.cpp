@@ -24,10 +24,14 @@
  */
 
 #include "face-manager.hpp"
+#include "status-tlv.hpp"
 
 #include "common/logger.hpp"
+#include "face/datagram-transport.hpp"
 #include "face/generic-link-service.hpp"
+#include "face/stream-transport.hpp"
 #include "face/protocol-factory.hpp"
+#include "face/shared-udp-transport.hpp"
 #include "fw/face-table.hpp"
 
 #include <ndn-cxx/lp/tags.hpp>
@@ -403,13 +407,50 @@ makeFaceStatus(const Face& face, const time::steady_clock::time_point& now)
   return status;
 }
 
+static Block
+encodeFaceStatus(const Face& face, const time::steady_clock::time_point& now)
+{
+  Block wire = makeFaceStatus(face, now).wireEncode();
+
+  auto transport = dynamic_cast<const face::DatagramTransportBase*>(face.getTransport());
+  if (transport != nullptr && transport->getBatchSize() > 1) {
+    using ndn::encoding::makeNonNegativeIntegerBlock;
+    const auto& counters = transport->getBatchCounters();
+    wire.parse();
+    wire.push_back(makeNonNegativeIntegerBlock(tlv::NRxBatches, counters.nRxBatches));
+    wire.push_back(makeNonNegativeIntegerBlock(tlv::NRxBatchedDatagrams, counters.nRxDatagrams));
+    wire.push_back(makeNonNegativeIntegerBlock(tlv::NTxBatches, counters.nTxBatches));
+    wire.push_back(makeNonNegativeIntegerBlock(tlv::NTxBatchedDatagrams, counters.nTxDatagrams));
+    wire.encode();
+  }
+
+  auto streamTransport = dynamic_cast<const face::StreamTransportBase*>(face.getTransport());
+  if (streamTransport != nullptr) {
+    using ndn::encoding::makeNonNegativeIntegerBlock;
+    const auto& counters = streamTransport->getSendQueueCounters();
+    wire.parse();
+    wire.push_back(makeNonNegativeIntegerBlock(tlv::NSendQueueHeadDrops, counters.nHeadDrops));
+    wire.push_back(makeNonNegativeIntegerBlock(tlv::NSendQueueTailDrops, counters.nTailDrops));
+    wire.encode();
+  }
+
+  auto sharedUdpTransport = dynamic_cast<const face::SharedUdpTransport*>(face.getTransport());
+  if (sharedUdpTransport != nullptr) {
+    using ndn::encoding::makeNonNegativeIntegerBlock;
+    wire.parse();
+    wire.push_back(makeNonNegativeIntegerBlock(tlv::NSendDrops, sharedUdpTransport->getNSendDrops()));
+    wire.encode();
+  }
+
+  return wire;
+}
+
 void
 FaceManager::listFaces(ndn::mgmt::StatusDatasetContext& context)
 {
   auto now = time::steady_clock::now();
   for (const auto& face : m_faceTable) {
-    ndn::nfd::FaceStatus status = makeFaceStatus(face, now);
-    context.append(status.wireEncode());
+    context.append(encodeFaceStatus(face, now));
   }
   context.end();
 }
@@ -486,8 +527,7 @@ FaceManager::queryFaces(const Interest& interest,
   auto now = time::steady_clock::now();
   for (const auto& face : m_faceTable) {
     if (matchFilter(faceFilter, face)) {
-      ndn::nfd::FaceStatus status = makeFaceStatus(face, now);
-      context.append(status.wireEncode());
+      context.append(encodeFaceStatus(face, now));
     }
   }
   context.end();
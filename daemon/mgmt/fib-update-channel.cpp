@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fib-update-channel.hpp"
+
+#include "common/global.hpp"
+#include "common/logger.hpp"
+#include "fw/face-table.hpp"
+#include "table/fib.hpp"
+
+#include <boost/asio/post.hpp>
+
+namespace nfd {
+
+NFD_LOG_INIT(FibUpdateChannel);
+
+constexpr uint32_t CODE_OK = 200;
+constexpr uint32_t ERROR_FACE_NOT_FOUND = 410;
+constexpr uint32_t ERROR_PREFIX_TOO_LONG = 414;
+
+static std::string
+makeReason(uint32_t code)
+{
+  switch (code) {
+    case ERROR_FACE_NOT_FOUND:
+      return "Face not found";
+    case ERROR_PREFIX_TOO_LONG:
+      return "FIB entry prefix cannot exceed " + std::to_string(Fib::getMaxDepth()) + " components";
+    default:
+      return "OK";
+  }
+}
+
+FibUpdateChannel::FibUpdateChannel(fib::Fib& fib, const FaceTable& faceTable,
+                                   boost::asio::io_context& mainIo)
+  : m_fib(fib)
+  , m_faceTable(faceTable)
+  , m_mainIo(mainIo)
+  , m_self(make_shared<FibUpdateChannel*>(this))
+{
+}
+
+void
+FibUpdateChannel::submit(std::vector<rib::FibUpdate> updates, uint64_t batchFaceId,
+                         SuccessCallback onSuccess, FailureCallback onFailure)
+{
+  boost::asio::post(m_mainIo,
+    [weakSelf = weak_ptr<FibUpdateChannel*>(m_self), &replyIo = getGlobalIoService(),
+     submitted = time::steady_clock::now(), updates = std::move(updates), batchFaceId,
+     onSuccess = std::move(onSuccess), onFailure = std::move(onFailure)] {
+      auto self = weakSelf.lock();
+      if (self == nullptr) {
+        return;
+      }
+      auto& counters = (*self)->m_counters;
+
+      auto started = time::steady_clock::now();
+      uint32_t code = (*self)->apply(updates, batchFaceId);
+      auto finished = time::steady_clock::now();
+
+      ++counters.nBatches;
+      if (code == CODE_OK) {
+        counters.nUpdates += updates.size();
+      }
+      else {
+        ++counters.nFailedBatches;
+      }
+      auto queueingDelay = time::duration_cast<time::nanoseconds>(started - submitted);
+      auto applyTime = time::duration_cast<time::nanoseconds>(finished - started);
+      counters.queueingDelay += queueingDelay.count();
+      counters.applyTime += applyTime.count();
+      NFD_LOG_DEBUG("Batch of " << updates.size() << " update(s) code=" << code
+                    << " queued=" << queueingDelay << " applied-in=" << applyTime
+                    << " total-batches=" << counters.nBatches.load()
+                    << " failed=" << counters.nFailedBatches.load());
+
+      boost::asio::post(replyIo, [code, onSuccess, onFailure] {
+        if (code == CODE_OK) {
+          onSuccess();
+        }
+        else {
+          onFailure(code, makeReason(code));
+        }
+      });
+    });
+}
+
+uint32_t
+FibUpdateChannel::apply(const std::vector<rib::FibUpdate>& updates, uint64_t batchFaceId)
+{
+  // validate first, so that a failed batch leaves the FIB untouched
+  for (const auto& update : updates) {
+    if (update.action != rib::FibUpdate::ADD_NEXTHOP) {
+      continue;
+    }
+    if (update.name.size() > Fib::getMaxDepth()) {
+      NFD_LOG_DEBUG("apply " << update << " -> FAIL prefix-too-long");
+      return ERROR_PREFIX_TOO_LONG;
+    }
+    if (update.faceId == batchFaceId && m_faceTable.get(update.faceId) == nullptr) {
+      NFD_LOG_DEBUG("apply " << update << " -> FAIL unknown-faceid");
+      return ERROR_FACE_NOT_FOUND;
+    }
+  }
+
+  NFD_LOG_DEBUG("Applying " << updates.size() << " FIB update(s)");
+  for (const auto& update : updates) {
+    Face* face = m_faceTable.get(update.faceId);
+    if (face == nullptr) {
+      NFD_LOG_TRACE("apply " << update << " -> SKIP no-face");
+      continue;
+    }
+
+    switch (update.action) {
+      case rib::FibUpdate::ADD_NEXTHOP: {
+        fib::Entry* entry = m_fib.insert(update.name).first;
+        m_fib.addOrUpdateNextHop(*entry, *face, update.cost);
+        break;
+      }
+      case rib::FibUpdate::REMOVE_NEXTHOP: {
+        fib::Entry* entry = m_fib.findExactMatch(update.name);
+        if (entry != nullptr) {
+          m_fib.removeNextHop(*entry, *face);
+        }
+        break;
+      }
+    }
+    NFD_LOG_TRACE("apply " << update << " -> OK");
+  }
+  return CODE_OK;
+}
+
+} // namespace nfd
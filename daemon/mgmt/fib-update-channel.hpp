@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_MGMT_FIB_UPDATE_CHANNEL_HPP
+#define NFD_DAEMON_MGMT_FIB_UPDATE_CHANNEL_HPP
+
+#include "rib/fib-update.hpp"
+
+#include <boost/asio/io_context.hpp>
+
+#include <atomic>
+
+namespace nfd {
+
+namespace fib {
+class Fib;
+} // namespace fib
+
+class FaceTable;
+
+/**
+ * \brief In-process channel through which the RIB thread programs the forwarder's FIB.
+ *
+ * The channel lives on the main thread next to the forwarder. A batch of FIB updates
+ * submitted from the RIB thread is posted to the main io_context as a single handler,
+ * so the whole batch is applied before the forwarder processes any other event, and the
+ * outcome is posted back to the io_context of the submitting thread. This replaces one
+ * FibAddNextHop/FibRemoveNextHop command Interest per update.
+ *
+ * The channel is owned by Nfd and handed to rib::Service when the RIB thread starts.
+ * Its counters are reported in the general status dataset; see ForwarderStatusManager.
+ */
+class FibUpdateChannel : noncopyable
+{
+public:
+  using SuccessCallback = std::function<void()>;
+  using FailureCallback = std::function<void(uint32_t code, const std::string& reason)>;
+
+  /**
+   * \brief Counters, updated on the main thread and readable from any thread.
+   */
+  struct Counters
+  {
+    std::atomic<uint64_t> nBatches{0};
+    std::atomic<uint64_t> nFailedBatches{0};
+    /// number of updates in successfully applied batches
+    std::atomic<uint64_t> nUpdates{0};
+    /// cumulative time between submission and the start of batch application, in nanoseconds
+    std::atomic<uint64_t> queueingDelay{0};
+    /// cumulative time spent applying batches on the main thread, in nanoseconds
+    std::atomic<uint64_t> applyTime{0};
+  };
+
+  /**
+   * \brief Create the channel.
+   * \param mainIo the io_context of the thread that owns \p fib and \p faceTable
+   */
+  FibUpdateChannel(fib::Fib& fib, const FaceTable& faceTable, boost::asio::io_context& mainIo);
+
+  /**
+   * \brief Apply \p updates to the FIB as one batch.
+   *
+   * The batch fails without modifying the FIB if an ADD_NEXTHOP update has a prefix that
+   * exceeds the FIB depth limit (code 414), or refers to \p batchFaceId and that face does
+   * not exist (code 410). Updates that refer to other nonexistent faces are skipped.
+   *
+   * This method may be called from any thread; \p onSuccess or \p onFailure is invoked on
+   * the io_context of the calling thread.
+   */
+  void
+  submit(std::vector<rib::FibUpdate> updates, uint64_t batchFaceId,
+         SuccessCallback onSuccess, FailureCallback onFailure);
+
+  const Counters&
+  getCounters() const noexcept
+  {
+    return m_counters;
+  }
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /**
+   * \brief Apply a batch on the main thread.
+   * \return 200 on success, or the error code described in submit()
+   */
+  uint32_t
+  apply(const std::vector<rib::FibUpdate>& updates, uint64_t batchFaceId);
+
+private:
+  fib::Fib& m_fib;
+  const FaceTable& m_faceTable;
+  boost::asio::io_context& m_mainIo;
+  Counters m_counters;
+  /// lets handlers still queued on the main io_context detect that the channel is gone
+  shared_ptr<FibUpdateChannel*> m_self;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_MGMT_FIB_UPDATE_CHANNEL_HPP
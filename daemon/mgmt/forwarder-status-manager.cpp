@@ -24,14 +24,21 @@
  */
 
 #include "forwarder-status-manager.hpp"
+#include "fib-update-channel.hpp"
+#include "status-tlv.hpp"
 #include "fw/forwarder.hpp"
+#include "common/memory-pool.hpp"
 #include "core/version.hpp"
 
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
 namespace nfd {
 
-ForwarderStatusManager::ForwarderStatusManager(Forwarder& forwarder, Dispatcher& dispatcher)
+ForwarderStatusManager::ForwarderStatusManager(Forwarder& forwarder, Dispatcher& dispatcher,
+                                               const FibUpdateChannel* fibUpdateChannel)
   : m_forwarder(forwarder)
   , m_dispatcher(dispatcher)
+  , m_fibUpdateChannel(fibUpdateChannel)
   , m_startTimestamp(time::system_clock::now())
 {
   m_dispatcher.addStatusDataset("status/general", ndn::mgmt::makeAcceptAllAuthorization(),
@@ -66,6 +73,36 @@ ForwarderStatusManager::collectGeneralStatus()
   return status;
 }
 
+static Block
+encodeMemoryPoolStatus(const MemoryPool& pool)
+{
+  using namespace ndn::encoding;
+
+  Block block(tlv::MemoryPoolStatus);
+  block.push_back(makeStringBlock(tlv::MemoryPoolName, pool.getName()));
+  block.push_back(makeNonNegativeIntegerBlock(tlv::MemoryPoolBlockSize, pool.getBlockSize()));
+  block.push_back(makeNonNegativeIntegerBlock(tlv::MemoryPoolNInUse, pool.getNInUse()));
+  block.push_back(makeNonNegativeIntegerBlock(tlv::MemoryPoolCapacity, pool.getCapacity()));
+  block.encode();
+  return block;
+}
+
+static Block
+encodeFibUpdateChannelStatus(const FibUpdateChannel::Counters& counters)
+{
+  using namespace ndn::encoding;
+
+  Block block(tlv::FibUpdateChannelStatus);
+  block.push_back(makeNonNegativeIntegerBlock(tlv::FibUpdateNBatches, counters.nBatches));
+  block.push_back(makeNonNegativeIntegerBlock(tlv::FibUpdateNFailedBatches,
+                                              counters.nFailedBatches));
+  block.push_back(makeNonNegativeIntegerBlock(tlv::FibUpdateNUpdates, counters.nUpdates));
+  block.push_back(makeNonNegativeIntegerBlock(tlv::FibUpdateQueueingDelay, counters.queueingDelay));
+  block.push_back(makeNonNegativeIntegerBlock(tlv::FibUpdateApplyTime, counters.applyTime));
+  block.encode();
+  return block;
+}
+
 void
 ForwarderStatusManager::listGeneralStatus(ndn::mgmt::StatusDatasetContext& context)
 {
@@ -75,6 +112,12 @@ ForwarderStatusManager::listGeneralStatus(ndn::mgmt::StatusDatasetContext& conte
   for (const auto& subblock : wire.elements()) {
     context.append(subblock);
   }
+  for (const MemoryPool* pool : MemoryPool::getPools()) {
+    context.append(encodeMemoryPoolStatus(*pool));
+  }
+  if (m_fibUpdateChannel != nullptr) {
+    context.append(encodeFibUpdateChannelStatus(m_fibUpdateChannel->getCounters()));
+  }
   context.end();
 }
 
@@ -32,6 +32,7 @@
 
 namespace nfd {
 
+class FibUpdateChannel;
 class Forwarder;
 
 /**
@@ -41,7 +42,11 @@ class Forwarder;
 class ForwarderStatusManager : noncopyable
 {
 public:
-  ForwarderStatusManager(Forwarder& forwarder, Dispatcher& dispatcher);
+  /**
+   * \param fibUpdateChannel if not null, its counters are included in the general status dataset
+   */
+  ForwarderStatusManager(Forwarder& forwarder, Dispatcher& dispatcher,
+                         const FibUpdateChannel* fibUpdateChannel = nullptr);
 
 private:
   ndn::nfd::ForwarderStatus
@@ -56,6 +61,7 @@ private:
 private:
   Forwarder& m_forwarder;
   Dispatcher& m_dispatcher;
+  const FibUpdateChannel* m_fibUpdateChannel;
   time::system_clock::time_point m_startTimestamp;
 };
 
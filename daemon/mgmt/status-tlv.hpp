@@ -0,0 +1,74 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_MGMT_STATUS_TLV_HPP
+#define NFD_DAEMON_MGMT_STATUS_TLV_HPP
+
+#include "core/common.hpp"
+
+namespace nfd::tlv {
+
+/**
+ * \brief TLV-TYPE numbers of NFD-specific elements in the management status datasets.
+ *
+ * These elements are appended to the standard datasets defined by the NFD Management Protocol.
+ * They are allocated from the range 0x0F20-0x0F5F, and all of them are even, i.e., non-critical,
+ * so that clients unaware of them ignore them.
+ */
+enum : uint32_t {
+  // ForwarderStatus dataset: one MemoryPoolStatus element per MemoryPool
+  MemoryPoolStatus         = 0x0F20,
+  MemoryPoolName           = 0x0F22,
+  MemoryPoolBlockSize      = 0x0F24,
+  MemoryPoolNInUse         = 0x0F26,
+  MemoryPoolCapacity       = 0x0F28,
+
+  // CsInfo dataset: byte-based capacity
+  CsMaxBytes               = 0x0F30,
+  CsNBytes                 = 0x0F32,
+
+  // FaceStatus dataset: batched datagram I/O counters
+  NRxBatches               = 0x0F40,
+  NRxBatchedDatagrams      = 0x0F42,
+  NTxBatches               = 0x0F44,
+  NTxBatchedDatagrams      = 0x0F46,
+  // FaceStatus dataset: send queue drop counters of stream transports
+  NSendQueueHeadDrops      = 0x0F48,
+  NSendQueueTailDrops      = 0x0F4A,
+  // FaceStatus dataset: send drop counter of faces on a shared UDP socket
+  NSendDrops               = 0x0F4C,
+
+  // ForwarderStatus dataset: FibUpdateChannelStatus, durations are cumulative nanoseconds
+  FibUpdateChannelStatus   = 0x0F50,
+  FibUpdateNBatches        = 0x0F52,
+  FibUpdateNFailedBatches  = 0x0F54,
+  FibUpdateNUpdates        = 0x0F56,
+  FibUpdateQueueingDelay   = 0x0F58,
+  FibUpdateApplyTime       = 0x0F5A,
+};
+
+} // namespace nfd::tlv
+
+#endif // NFD_DAEMON_MGMT_STATUS_TLV_HPP
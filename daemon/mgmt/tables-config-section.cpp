@@ -26,11 +26,13 @@
 #include "tables-config-section.hpp"
 #include "fw/strategy.hpp"
 
+#include <limits>
 #include <map>
 
 namespace nfd {
 
 constexpr size_t DEFAULT_CS_MAX_PACKETS = 65536;
+constexpr size_t DEFAULT_CS_MAX_BYTES = std::numeric_limits<size_t>::max(); // unlimited
 
 TablesConfigSection::TablesConfigSection(Forwarder& forwarder)
   : m_forwarder(forwarder)
@@ -54,6 +56,8 @@ TablesConfigSection::ensureConfigured()
   }
 
   m_forwarder.getCs().setLimit(DEFAULT_CS_MAX_PACKETS);
+  m_forwarder.getCs().setLimitBytes(DEFAULT_CS_MAX_BYTES);
+  m_forwarder.getCs().enableNameIndex(false);
   // Don't set default cs_policy because it's already created by CS itself.
   m_forwarder.setUnsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>());
 
@@ -69,6 +73,12 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun,
     nCsMaxPackets = ConfigFile::parseNumber<size_t>(*csMaxPacketsNode, "cs_max_packets", "tables");
   }
 
+  size_t nCsMaxBytes = DEFAULT_CS_MAX_BYTES;
+  OptionalConfigSection csMaxBytesNode = section.get_child_optional("cs_max_bytes");
+  if (csMaxBytesNode) {
+    nCsMaxBytes = ConfigFile::parseNumber<size_t>(*csMaxBytesNode, "cs_max_bytes", "tables");
+  }
+
   unique_ptr<cs::Policy> csPolicy;
   OptionalConfigSection csPolicyNode = section.get_child_optional("cs_policy");
   if (csPolicyNode) {
@@ -92,6 +102,12 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun,
     unsolicitedDataPolicy = make_unique<fw::DefaultUnsolicitedDataPolicy>();
   }
 
+  bool wantCsNameIndex = false;
+  OptionalConfigSection csNameIndexNode = section.get_child_optional("cs_name_index");
+  if (csNameIndexNode) {
+    wantCsNameIndex = ConfigFile::parseYesNo(*csNameIndexNode, "cs_name_index", "tables");
+  }
+
   OptionalConfigSection strategyChoiceSection = section.get_child_optional("strategy_choice");
   if (strategyChoiceSection) {
     processStrategyChoiceSection(*strategyChoiceSection, isDryRun);
@@ -108,9 +124,11 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun,
 
   Cs& cs = m_forwarder.getCs();
   cs.setLimit(nCsMaxPackets);
+  cs.setLimitBytes(nCsMaxBytes);
   if (cs.size() == 0 && csPolicy != nullptr) {
     cs.setPolicy(std::move(csPolicy));
   }
+  cs.enableNameIndex(wantCsNameIndex);
 
   m_forwarder.setUnsolicitedDataPolicy(std::move(unsolicitedDataPolicy));
 
@@ -38,8 +38,10 @@ namespace nfd {
  *  tables
  *  {
  *    cs_max_packets 65536
+ *    cs_max_bytes 536870912
  *    cs_policy lru
  *    cs_unsolicited_policy drop-all
+ *    cs_name_index no
  *
  *    strategy_choice
  *    {
@@ -58,7 +60,8 @@ namespace nfd {
  *  \endcode
  *
  *  During a configuration reload,
- *  \li cs_max_packets, cs_policy, and cs_unsolicited_policy are applied;
+ *  \li cs_max_packets, cs_max_bytes, cs_policy, cs_unsolicited_policy, and cs_name_index
+ *      are applied;
  *      defaults are used if an option is omitted.
  *  \li strategy_choice entries are inserted, but old entries are not deleted.
  *  \li network_region is applied; it's kept unchanged if the section is omitted.
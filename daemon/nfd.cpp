@@ -35,6 +35,7 @@
 #include "mgmt/cs-manager.hpp"
 #include "mgmt/face-manager.hpp"
 #include "mgmt/fib-manager.hpp"
+#include "mgmt/fib-update-channel.hpp"
 #include "mgmt/forwarder-status-manager.hpp"
 #include "mgmt/general-config-section.hpp"
 #include "mgmt/log-config-section.hpp"
@@ -138,7 +139,10 @@ Nfd::initializeManagement()
   m_dispatcher = make_unique<ndn::mgmt::Dispatcher>(*m_internalClientFace, m_keyChain);
   m_authenticator = CommandAuthenticator::create();
 
-  m_forwarderStatusManager = make_unique<ForwarderStatusManager>(*m_forwarder, *m_dispatcher);
+  m_fibUpdateChannel = make_unique<FibUpdateChannel>(m_forwarder->getFib(), *m_faceTable,
+                                                     getGlobalIoService());
+  m_forwarderStatusManager = make_unique<ForwarderStatusManager>(*m_forwarder, *m_dispatcher,
+                                                                 m_fibUpdateChannel.get());
   m_faceManager = make_unique<FaceManager>(*m_faceSystem, *m_dispatcher, *m_authenticator);
   m_fibManager = make_unique<FibManager>(m_forwarder->getFib(), *m_faceTable,
                                          *m_dispatcher, *m_authenticator);
@@ -43,6 +43,7 @@ class CommandAuthenticator;
 class ForwarderStatusManager;
 class FaceManager;
 class FibManager;
+class FibUpdateChannel;
 class CsManager;
 class StrategyChoiceManager;
 
@@ -94,6 +95,16 @@ public:
   void
   reloadConfigFile();
 
+  /**
+   * \brief Get the channel through which the RIB thread programs the FIB.
+   * \pre initialize() has been called
+   */
+  FibUpdateChannel*
+  getFibUpdateChannel() const noexcept
+  {
+    return m_fibUpdateChannel.get();
+  }
+
 private:
   explicit
   Nfd(ndn::KeyChain& keyChain);
@@ -123,6 +134,7 @@ private:
   unique_ptr<ForwarderStatusManager> m_forwarderStatusManager;
   unique_ptr<FaceManager> m_faceManager;
   unique_ptr<FibManager> m_fibManager;
+  unique_ptr<FibUpdateChannel> m_fibUpdateChannel;
   unique_ptr<CsManager> m_csManager;
   unique_ptr<StrategyChoiceManager> m_strategyChoiceManager;
 
@@ -25,6 +25,7 @@
 
 #include "fib-updater.hpp"
 #include "common/logger.hpp"
+#include "mgmt/fib-update-channel.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-command.hpp>
 
@@ -35,9 +36,10 @@ NFD_LOG_INIT(FibUpdater);
 constexpr int MAX_NUM_TIMEOUTS = 10;
 constexpr uint32_t ERROR_FACE_NOT_FOUND = 410;
 
-FibUpdater::FibUpdater(Rib& rib, ndn::nfd::Controller& controller)
+FibUpdater::FibUpdater(Rib& rib, ndn::nfd::Controller& controller, FibUpdateChannel* channel)
   : m_rib(rib)
   , m_controller(controller)
+  , m_channel(channel)
 {
   rib.setFibUpdater(this);
 }
@@ -58,7 +60,12 @@ FibUpdater::computeAndSendFibUpdates(const RibUpdateBatch& batch,
 
   computeUpdates(batch);
 
-  sendUpdatesForBatchFaceId(onSuccess, onFailure);
+  if (m_channel != nullptr) {
+    sendUpdatesToChannel(onSuccess, onFailure);
+  }
+  else {
+    sendUpdatesForBatchFaceId(onSuccess, onFailure);
+  }
 }
 
 void
@@ -116,19 +123,9 @@ FibUpdater::computeUpdatesForRegistration(const RibUpdate& update)
   }
   else {
     // New name in RIB
-    // Find prefix's parent
-    shared_ptr<RibEntry> parent = m_rib.findParent(update.name);
-
-    Rib::RibEntryList descendants = m_rib.findDescendantsForNonInsertedName(update.name);
-    Rib::RibEntryList children;
-
-    for (const auto& descendant : descendants) {
-      // If the child has the same parent as the new entry,
-      // the new entry must be the child's new parent
-      if (descendant->getParent() == parent) {
-        children.push_back(descendant);
-      }
-    }
+    // The topmost entries under the new name currently share the new entry's parent,
+    // so the new entry will become their parent
+    Rib::RibEntryList children = m_rib.findDescendants(update.name);
 
     createFibUpdatesForNewRibEntry(update.name, update.route, children);
   }
@@ -213,6 +210,34 @@ FibUpdater::sendUpdatesForNonBatchFaceId(const FibUpdateSuccessCallback& onSucce
   }
 }
 
+void
+FibUpdater::sendUpdatesToChannel(const FibUpdateSuccessCallback& onSuccess,
+                                 const FibUpdateFailureCallback& onFailure)
+{
+  std::vector<FibUpdate> updates;
+  updates.reserve(m_updatesForBatchFaceId.size() + m_updatesForNonBatchFaceId.size());
+  updates.insert(updates.end(), m_updatesForBatchFaceId.begin(), m_updatesForBatchFaceId.end());
+  updates.insert(updates.end(), m_updatesForNonBatchFaceId.begin(), m_updatesForNonBatchFaceId.end());
+  m_updatesForBatchFaceId.clear();
+  m_updatesForNonBatchFaceId.clear();
+
+  if (updates.empty()) {
+    onSuccess(m_inheritedRoutes);
+    return;
+  }
+
+  NFD_LOG_DEBUG("Submitting " << updates.size() << " FIB update(s)");
+  m_channel->submit(std::move(updates), m_batchFaceId,
+    [this, onSuccess] { onSuccess(m_inheritedRoutes); },
+    [onFailure] (uint32_t code, const std::string& reason) {
+      NFD_LOG_DEBUG("Failed to apply FIB update batch [code: " << code << ", error: " << reason << "]");
+      if (code != ERROR_FACE_NOT_FOUND) {
+        NDN_THROW(Error("Non-recoverable error " + std::to_string(code) + ": " + reason));
+      }
+      onFailure(code, reason);
+    });
+}
+
 void
 FibUpdater::sendAddNextHopUpdate(const FibUpdate& update,
                                  const FibUpdateSuccessCallback& onSuccess,
@@ -33,6 +33,10 @@
 
 #include <ndn-cxx/mgmt/nfd/controller.hpp>
 
+namespace nfd {
+class FibUpdateChannel;
+} // namespace nfd
+
 namespace nfd::rib {
 
 /**
@@ -51,7 +55,12 @@ public:
   using FibUpdateSuccessCallback = std::function<void(RibUpdateList inheritedRoutes)>;
   using FibUpdateFailureCallback = std::function<void(uint32_t code, const std::string& error)>;
 
-  FibUpdater(Rib& rib, ndn::nfd::Controller& controller);
+  /**
+   * \param channel if not null, FIB updates are applied through this in-process channel,
+   *                one batch per RibUpdateBatch, instead of as FIB management commands
+   *                sent through \p controller
+   */
+  FibUpdater(Rib& rib, ndn::nfd::Controller& controller, FibUpdateChannel* channel = nullptr);
 
 #ifdef NFD_WITH_TESTS
   virtual
@@ -107,6 +116,13 @@ private:
   sendUpdatesForNonBatchFaceId(const FibUpdateSuccessCallback& onSuccess,
                                const FibUpdateFailureCallback& onFailure);
 
+  /**
+   * \brief Submits all computed updates to the FibUpdateChannel as a single batch.
+   */
+  void
+  sendUpdatesToChannel(const FibUpdateSuccessCallback& onSuccess,
+                       const FibUpdateFailureCallback& onFailure);
+
 NFD_PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   /**
    * \brief Sends a FibAddNextHopCommand to NFD using the parameters supplied by
@@ -277,6 +293,7 @@ private:
 private:
   const Rib& m_rib;
   ndn::nfd::Controller& m_controller;
+  FibUpdateChannel* m_channel;
   uint64_t m_batchFaceId;
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
@@ -130,15 +130,16 @@ Rib::insert(const Name& prefix, const Route& route)
 
     auto children = findDescendants(prefix);
     for (const auto& child : children) {
-      if (child->getParent() == parent) {
-        // Remove child from parent and inherit parent's child
-        if (parent != nullptr) {
-          parent->removeChild(child);
-        }
-        entry->addChild(child);
+      BOOST_ASSERT(child->getParent() == parent);
+      // Remove child from parent and inherit parent's child
+      if (parent != nullptr) {
+        parent->removeChild(child);
       }
+      entry->addChild(child);
     }
 
+    insertTrieEntry(prefix, entry);
+
     // Register with face lookup table
     m_faceEntries.emplace(route.faceId, entry);
 
@@ -195,14 +196,25 @@ Rib::onRouteExpiration(const Name& prefix, const Route& route)
 shared_ptr<RibEntry>
 Rib::findParent(const Name& prefix) const
 {
-  for (int i = prefix.size() - 1; i >= 0; i--) {
-    auto it = m_rib.find(prefix.getPrefix(i));
-    if (it != m_rib.end()) {
-      return it->second;
+  if (prefix.empty()) {
+    return nullptr;
+  }
+
+  // walk down the trie along prefix.getPrefix(-1), remembering the deepest entry
+  const TrieNode* node = &m_trieRoot;
+  shared_ptr<RibEntry> parent = node->entry;
+  for (size_t i = 0; i + 1 < prefix.size(); ++i) {
+    auto it = node->children.find(prefix[i]);
+    if (it == node->children.end()) {
+      break;
+    }
+    node = it->second.get();
+    if (node->entry != nullptr) {
+      parent = node->entry;
     }
   }
 
-  return nullptr;
+  return parent;
 }
 
 std::list<shared_ptr<RibEntry>>
@@ -210,34 +222,76 @@ Rib::findDescendants(const Name& prefix) const
 {
   std::list<shared_ptr<RibEntry>> children;
 
-  auto it = m_rib.find(prefix);
-  if (it != m_rib.end()) {
-    ++it;
-    for (; it != m_rib.end(); ++it) {
-      if (prefix.isPrefixOf(it->first)) {
-        children.push_back(it->second);
-      }
-      else {
-        break;
-      }
+  const TrieNode* node = findTrieNode(prefix);
+  if (node == nullptr) {
+    return children;
+  }
+
+  // depth-first search that stops at the first entry on each branch
+  std::vector<const TrieNode*> stack;
+  for (const auto& child : node->children) {
+    stack.push_back(child.second.get());
+  }
+  while (!stack.empty()) {
+    const TrieNode* n = stack.back();
+    stack.pop_back();
+    if (n->entry != nullptr) {
+      children.push_back(n->entry);
+      continue;
+    }
+    for (const auto& child : n->children) {
+      stack.push_back(child.second.get());
     }
   }
 
+  children.sort([] (const auto& a, const auto& b) { return a->getName() < b->getName(); });
   return children;
 }
 
-std::list<shared_ptr<RibEntry>>
-Rib::findDescendantsForNonInsertedName(const Name& prefix) const
+const Rib::TrieNode*
+Rib::findTrieNode(const Name& prefix) const
 {
-  std::list<shared_ptr<RibEntry>> children;
+  const TrieNode* node = &m_trieRoot;
+  for (const auto& comp : prefix) {
+    auto it = node->children.find(comp);
+    if (it == node->children.end()) {
+      return nullptr;
+    }
+    node = it->second.get();
+  }
+  return node;
+}
 
-  for (const auto& [name, ribEntry] : m_rib) {
-    if (prefix.isPrefixOf(name)) {
-      children.push_back(ribEntry);
+void
+Rib::insertTrieEntry(const Name& prefix, shared_ptr<RibEntry> entry)
+{
+  TrieNode* node = &m_trieRoot;
+  for (const auto& comp : prefix) {
+    auto& child = node->children[comp];
+    if (child == nullptr) {
+      child = make_unique<TrieNode>();
+      child->parent = node;
     }
+    node = child.get();
+  }
+  node->entry = std::move(entry);
+}
+
+void
+Rib::eraseTrieEntry(const Name& prefix)
+{
+  auto node = const_cast<TrieNode*>(findTrieNode(prefix));
+  if (node == nullptr) {
+    return;
   }
+  node->entry = nullptr;
 
-  return children;
+  // prune nodes that no longer lead to any entry
+  for (size_t i = prefix.size(); i > 0 && node->entry == nullptr && node->children.empty(); --i) {
+    TrieNode* parent = node->parent;
+    parent->children.erase(prefix[i - 1]);
+    node = parent;
+  }
 }
 
 Rib::RibTable::iterator
@@ -271,6 +325,7 @@ Rib::eraseEntry(RibTable::iterator it)
     }
   }
 
+  eraseTrieEntry(entry->getName());
   auto nextIt = m_rib.erase(it);
 
   // do something after erasing an entry
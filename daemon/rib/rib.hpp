@@ -33,6 +33,8 @@
 
 #include <functional>
 #include <map>
+#include <string_view>
+#include <unordered_map>
 
 namespace nfd::rib {
 
@@ -178,18 +180,15 @@ private:
   using RouteComparePredicate = bool (*)(const Route&, const Route&);
   using RouteSet = std::set<Route, RouteComparePredicate>;
 
-  /** \brief Find entries under \p prefix.
-   *  \pre a RIB entry exists at \p prefix
+  /** \brief Find the topmost entries strictly under \p prefix.
+   *
+   *  These are the entries under \p prefix that have no other entry between them and
+   *  \p prefix, i.e., the children of a RIB entry at \p prefix, whether or not such an
+   *  entry exists. The result is sorted in canonical name order.
    */
   std::list<shared_ptr<RibEntry>>
   findDescendants(const Name& prefix) const;
 
-  /** \brief Find entries under \p prefix.
-   *  \pre a RIB entry does not exist at \p prefix
-   */
-  std::list<shared_ptr<RibEntry>>
-  findDescendantsForNonInsertedName(const Name& prefix) const;
-
   RibTable::iterator
   eraseEntry(RibTable::iterator it);
 
@@ -238,8 +237,45 @@ public:
    */
   signal::Signal<Rib, RibRouteRef> beforeRemoveRoute;
 
+private:
+  struct ComponentHash
+  {
+    size_t
+    operator()(const name::Component& comp) const noexcept
+    {
+      return std::hash<std::string_view>{}({reinterpret_cast<const char*>(comp.data()), comp.size()});
+    }
+  };
+
+  /** \brief A node of the name trie that indexes RIB entries by name component.
+   *
+   *  A node exists for a prefix only while some RIB entry lives at or under that prefix,
+   *  so parent and descendant lookups take time proportional to the name depth and the
+   *  number of nodes visited, independent of the RIB size.
+   */
+  struct TrieNode
+  {
+    TrieNode* parent = nullptr;
+    shared_ptr<RibEntry> entry;
+    std::unordered_map<name::Component, unique_ptr<TrieNode>, ComponentHash> children;
+  };
+
+  /** \brief Find the trie node of \p prefix.
+   *  \return the node, or nullptr if it does not exist
+   */
+  const TrieNode*
+  findTrieNode(const Name& prefix) const;
+
+  void
+  insertTrieEntry(const Name& prefix, shared_ptr<RibEntry> entry);
+
+  void
+  eraseTrieEntry(const Name& prefix);
+
 private:
   RibTable m_rib;
+  // name trie over the entries of m_rib
+  TrieNode m_trieRoot;
   // FaceId => Entry with Route on this face
   std::multimap<uint64_t, shared_ptr<RibEntry>> m_faceEntries;
   size_t m_nItems = 0;
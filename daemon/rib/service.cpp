@@ -85,16 +85,20 @@ makeLocalNfdTransport(const ConfigSection& config)
   }
 }
 
-Service::Service(const std::string& configFile, ndn::KeyChain& keyChain)
+Service::Service(const std::string& configFile, ndn::KeyChain& keyChain,
+                 FibUpdateChannel* fibUpdateChannel)
   : Service(keyChain, makeLocalNfdTransport(loadConfigSectionFromFile(configFile)),
+            fibUpdateChannel,
             [&configFile] (ConfigFile& config, bool isDryRun) {
               config.parse(configFile, isDryRun);
             })
 {
 }
 
-Service::Service(const ConfigSection& configSection, ndn::KeyChain& keyChain)
+Service::Service(const ConfigSection& configSection, ndn::KeyChain& keyChain,
+                 FibUpdateChannel* fibUpdateChannel)
   : Service(keyChain, makeLocalNfdTransport(configSection),
+            fibUpdateChannel,
             [&configSection] (ConfigFile& config, bool isDryRun) {
               config.parse(configSection, isDryRun, "internal://nfd.conf");
             })
@@ -103,11 +107,11 @@ Service::Service(const ConfigSection& configSection, ndn::KeyChain& keyChain)
 
 template<typename ConfigParseFunc>
 Service::Service(ndn::KeyChain& keyChain, shared_ptr<ndn::Transport> localNfdTransport,
-                 const ConfigParseFunc& configParse)
+                 FibUpdateChannel* fibUpdateChannel, const ConfigParseFunc& configParse)
   : m_keyChain(keyChain)
   , m_face(std::move(localNfdTransport), getGlobalIoService(), m_keyChain)
   , m_nfdController(m_face, m_keyChain)
-  , m_fibUpdater(m_rib, m_nfdController)
+  , m_fibUpdater(m_rib, m_nfdController, fibUpdateChannel)
   , m_dispatcher(m_face, m_keyChain)
   , m_ribManager(m_rib, m_face, m_keyChain, m_nfdController, m_dispatcher)
 {
@@ -55,22 +55,28 @@ public:
    * \brief Create NFD-RIB service.
    * \param configFile absolute or relative path of configuration file
    * \param keyChain the KeyChain
+   * \param fibUpdateChannel if not null, the FIB is programmed through this in-process channel
+   *                         instead of with FIB management commands
    * \throw std::logic_error Instance of rib::Service has been already constructed
    * \throw std::logic_error Instance of rib::Service is not constructed on RIB thread
    */
-  Service(const std::string& configFile, ndn::KeyChain& keyChain);
+  Service(const std::string& configFile, ndn::KeyChain& keyChain,
+          FibUpdateChannel* fibUpdateChannel = nullptr);
 
   /**
    * \brief Create NFD-RIB service.
    * \param configSection parsed configuration section
    * \param keyChain the KeyChain
+   * \param fibUpdateChannel if not null, the FIB is programmed through this in-process channel
+   *                         instead of with FIB management commands
    * \note This constructor overload is more appropriate for integrated environments,
    *       such as NS-3 or android. Error messages related to configuration file
    *       will use "internal://nfd.conf" as configuration filename.
    * \throw std::logic_error Instance of rib::Service has been already constructed
    * \throw std::logic_error Instance of rib::Service is not constructed on RIB thread
    */
-  Service(const ConfigSection& configSection, ndn::KeyChain& keyChain);
+  Service(const ConfigSection& configSection, ndn::KeyChain& keyChain,
+          FibUpdateChannel* fibUpdateChannel = nullptr);
 
   ~Service();
 
@@ -91,7 +97,7 @@ public:
 private:
   template<typename ConfigParseFunc>
   Service(ndn::KeyChain& keyChain, shared_ptr<ndn::Transport> localNfdTransport,
-          const ConfigParseFunc& configParse);
+          FibUpdateChannel* fibUpdateChannel, const ConfigParseFunc& configParse);
 
   void
   processConfig(const ConfigSection& section, bool isDryRun, const std::string& filename);
@@ -71,6 +71,21 @@ Policy::setLimit(size_t nMaxEntries)
   this->evictEntries();
 }
 
+void
+Policy::setLimitBytes(size_t nMaxBytes)
+{
+  NFD_LOG_INFO("setLimitBytes " << nMaxBytes);
+  m_limitBytes = nMaxBytes;
+  this->evictEntries();
+}
+
+bool
+Policy::isOverLimit() const
+{
+  BOOST_ASSERT(m_cs != nullptr);
+  return m_cs->size() > m_limit || m_cs->getNBytes() > m_limitBytes;
+}
+
 void
 Policy::afterInsert(EntryRef i)
 {
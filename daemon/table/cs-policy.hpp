@@ -29,6 +29,7 @@
 #include "cs-entry.hpp"
 
 #include <functional>
+#include <limits>
 #include <map>
 #include <set>
 
@@ -110,6 +111,24 @@ public:
   void
   setLimit(size_t nMaxEntries);
 
+  /**
+   * \brief Gets hard limit (in total wire size of Data packets, in octets).
+   */
+  size_t
+  getLimitBytes() const noexcept
+  {
+    return m_limitBytes;
+  }
+
+  /** \brief Sets hard limit (in total wire size of Data packets, in octets).
+   *  \post getLimitBytes() == nMaxBytes
+   *  \post cs.getNBytes() <= getLimitBytes()
+   *
+   *  The policy may evict entries if necessary.
+   */
+  void
+  setLimitBytes(size_t nMaxBytes);
+
 public:
   /** \brief A reference to a CS entry.
    *  \note `operator<` of EntryRef compares the Data name enclosed in the Entry.
@@ -125,6 +144,7 @@ public:
 
   /** \brief Invoked by CS after a new entry is inserted.
    *  \post cs.size() <= getLimit()
+   *  \post cs.getNBytes() <= getLimitBytes()
    *
    *  The policy may evict entries if necessary.
    *  During this process, \p i might be evicted.
@@ -190,7 +210,7 @@ protected:
   doBeforeUse(EntryRef i) = 0;
 
   /** \brief Evicts zero or more entries.
-   *  \post CS size does not exceed hard limit
+   *  \post CS size does not exceed hard limits
    */
   virtual void
   evictEntries() = 0;
@@ -199,6 +219,13 @@ protected:
   explicit
   Policy(std::string_view policyName);
 
+  /** \brief Returns whether the CS exceeds either the packet limit or the byte limit.
+   *
+   *  A policy implementation should evict entries while this returns true.
+   */
+  bool
+  isOverLimit() const;
+
   DECLARE_SIGNAL_EMIT(beforeEvict)
 
 private: // registry
@@ -211,6 +238,7 @@ private: // registry
 private:
   const std::string m_policyName;
   size_t m_limit;
+  size_t m_limitBytes = std::numeric_limits<size_t>::max();
   Cs* m_cs;
 };
 
@@ -39,6 +39,19 @@ makeDefaultPolicy()
   return Policy::create("lru");
 }
 
+// A Data decoded by a face without copying shares the face's receive buffer (see
+// face::ReceiveBufferPool). If that buffer is much larger than the Data, storing the packet
+// would pin memory that the byte limit does not account for, so store a compact copy instead.
+static shared_ptr<const Data>
+makeStoredData(const Data& data)
+{
+  const Block& wire = data.wireEncode();
+  if (wire.getBuffer() == nullptr || wire.getBuffer()->size() <= 2 * wire.size()) {
+    return data.shared_from_this();
+  }
+  return make_shared<Data>(Block(span<const uint8_t>(wire.data(), wire.size())));
+}
+
 Cs::Cs(size_t nMaxPackets)
 {
   setPolicyImpl(makeDefaultPolicy());
@@ -48,7 +61,8 @@ Cs::Cs(size_t nMaxPackets)
 void
 Cs::insert(const Data& data, bool isUnsolicited)
 {
-  if (!m_shouldAdmit || m_policy->getLimit() == 0) {
+  if (!m_shouldAdmit || m_policy->getLimit() == 0 ||
+      data.wireEncode().size() > m_policy->getLimitBytes()) {
     return;
   }
   NFD_LOG_DEBUG("insert " << data.getName());
@@ -62,7 +76,7 @@ Cs::insert(const Data& data, bool isUnsolicited)
     }
   }
 
-  auto [it, isNewEntry] = m_table.emplace(data.shared_from_this(), isUnsolicited);
+  auto [it, isNewEntry] = m_table.emplace(makeStoredData(data), isUnsolicited);
   auto& entry = const_cast<Entry&>(*it);
 
   entry.updateFreshUntil();
@@ -75,6 +89,10 @@ Cs::insert(const Data& data, bool isUnsolicited)
     m_policy->afterRefresh(it);
   }
   else {
+    m_nBytes += entry.getData().wireEncode().size();
+    if (m_hasNameIndex) {
+      addToNameIndex(it);
+    }
     m_policy->afterInsert(it);
   }
 }
@@ -99,7 +117,7 @@ Cs::eraseImpl(const Name& prefix, size_t limit)
   size_t nErased = 0;
   while (i != last && nErased < limit) {
     m_policy->beforeErase(i);
-    i = m_table.erase(i);
+    eraseEntry(i++);
     ++nErased;
   }
   return nErased;
@@ -113,11 +131,20 @@ Cs::findImpl(const Interest& interest) const
   }
 
   const Name& prefix = interest.getName();
-  auto range = findPrefixRange(prefix);
-  auto match = std::find_if(range.first, range.second,
-                            [&interest] (const auto& entry) { return entry.canSatisfy(interest); });
+  const_iterator match;
+  if (m_hasNameIndex && !interest.getCanBePrefix()) {
+    match = findExactMatch(interest);
+  }
+  else {
+    auto range = findPrefixRange(prefix);
+    match = std::find_if(range.first, range.second,
+                         [&interest] (const auto& entry) { return entry.canSatisfy(interest); });
+    if (match == range.second) {
+      match = m_table.end();
+    }
+  }
 
-  if (match == range.second) {
+  if (match == m_table.end()) {
     NFD_LOG_DEBUG("find " << prefix << " no-match");
     return m_table.end();
   }
@@ -126,14 +153,73 @@ Cs::findImpl(const Interest& interest) const
   return match;
 }
 
+Cs::const_iterator
+Cs::findExactMatch(const Interest& interest) const
+{
+  const Name& name = interest.getName();
+  const auto& hashes = name_tree::getHashes(interest);
+  auto getHash = [&] (size_t prefixLen) {
+    return prefixLen < hashes.size() ? hashes[prefixLen] : name_tree::computeHash(name, prefixLen);
+  };
+
+  // Among the entries that can satisfy the Interest, return the first in Table order,
+  // which is what a scan of the prefix range would have found.
+  auto best = m_table.end();
+  auto considerCandidates = [&] (name_tree::HashValue h) {
+    auto range = m_nameIndex.equal_range(h);
+    for (auto i = range.first; i != range.second; ++i) {
+      auto it = i->second;
+      if (it->canSatisfy(interest) && (best == m_table.end() || *it < *best)) {
+        best = it;
+      }
+    }
+  };
+
+  // Data name equals Interest name
+  considerCandidates(getHash(name.size()));
+  // Data full name equals Interest name
+  if (!name.empty() && name[-1].isImplicitSha256Digest()) {
+    considerCandidates(getHash(name.size() - 1));
+  }
+  return best;
+}
+
+void
+Cs::eraseEntry(const_iterator it)
+{
+  if (m_hasNameIndex) {
+    removeFromNameIndex(it);
+  }
+  BOOST_ASSERT(m_nBytes >= it->getData().wireEncode().size());
+  m_nBytes -= it->getData().wireEncode().size();
+  m_table.erase(it);
+}
+
+void
+Cs::addToNameIndex(const_iterator it)
+{
+  m_nameIndex.emplace(name_tree::computeHash(it->getName()), it);
+}
+
+void
+Cs::removeFromNameIndex(const_iterator it)
+{
+  auto range = m_nameIndex.equal_range(name_tree::computeHash(it->getName()));
+  auto found = std::find_if(range.first, range.second, [it] (const auto& p) { return p.second == it; });
+  BOOST_ASSERT(found != range.second);
+  m_nameIndex.erase(found);
+}
+
 void
 Cs::setPolicy(unique_ptr<Policy> policy)
 {
   BOOST_ASSERT(policy != nullptr);
   BOOST_ASSERT(m_policy != nullptr);
   size_t limit = m_policy->getLimit();
+  size_t limitBytes = m_policy->getLimitBytes();
   this->setPolicyImpl(std::move(policy));
   m_policy->setLimit(limit);
+  m_policy->setLimitBytes(limitBytes);
 }
 
 void
@@ -141,7 +227,7 @@ Cs::setPolicyImpl(unique_ptr<Policy> policy)
 {
   NFD_LOG_DEBUG("set-policy " << policy->getName());
   m_policy = std::move(policy);
-  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (auto it) { m_table.erase(it); });
+  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (auto it) { eraseEntry(it); });
 
   m_policy->setCs(this);
   BOOST_ASSERT(m_policy->getCs() == this);
@@ -167,4 +253,22 @@ Cs::enableServe(bool shouldServe) noexcept
   NFD_LOG_INFO((shouldServe ? "Enabling" : "Disabling") << " Data serving");
 }
 
+void
+Cs::enableNameIndex(bool wantNameIndex)
+{
+  if (m_hasNameIndex == wantNameIndex) {
+    return;
+  }
+  m_hasNameIndex = wantNameIndex;
+
+  m_nameIndex.clear();
+  if (m_hasNameIndex) {
+    m_nameIndex.reserve(m_table.size());
+    for (auto it = m_table.begin(); it != m_table.end(); ++it) {
+      addToNameIndex(it);
+    }
+  }
+  NFD_LOG_INFO((wantNameIndex ? "Enabling" : "Disabling") << " name index");
+}
+
 } // namespace nfd::cs
@@ -27,6 +27,9 @@
 #define NFD_DAEMON_TABLE_CS_HPP
 
 #include "cs-policy.hpp"
+#include "name-tree-hashtable.hpp"
+
+#include <unordered_map>
 
 namespace nfd {
 namespace cs {
@@ -39,6 +42,12 @@ namespace cs {
  *  Data packets are wrapped in Entry objects. Each Entry contains the Data packet itself,
  *  and a few additional attributes such as when the Data becomes non-fresh.
  *
+ *  Optionally, a hash index on the Data name (excluding the implicit digest) serves lookups
+ *  of Interests without CanBePrefix, which can only be satisfied by Data whose name equals
+ *  the Interest name or whose full name equals the Interest name. This replaces O(log n)
+ *  name comparisons with a hash lookup, at the cost of one index node per entry.
+ *  The ordered Table is still used for CanBePrefix lookups and prefix erasure.
+ *
  *  The replacement policy is implemented in a subclass of \c Policy.
  */
 class Cs : noncopyable
@@ -96,6 +105,14 @@ public:
     return m_table.size();
   }
 
+  /** \brief Get total wire size of stored packets, in octets.
+   */
+  size_t
+  getNBytes() const noexcept
+  {
+    return m_nBytes;
+  }
+
 public: // configuration
   /** \brief Get capacity (in number of packets).
    */
@@ -113,6 +130,22 @@ public: // configuration
     return m_policy->setLimit(nMaxPackets);
   }
 
+  /** \brief Get capacity (in total wire size of packets, in octets).
+   */
+  size_t
+  getLimitBytes() const noexcept
+  {
+    return m_policy->getLimitBytes();
+  }
+
+  /** \brief Change capacity (in total wire size of packets, in octets).
+   */
+  void
+  setLimitBytes(size_t nMaxBytes)
+  {
+    return m_policy->setLimitBytes(nMaxBytes);
+  }
+
   /** \brief Get replacement policy.
    */
   Policy*
@@ -157,6 +190,21 @@ public: // configuration
   void
   enableServe(bool shouldServe) noexcept;
 
+  /** \brief Get whether the hash index on Data names is enabled.
+   */
+  bool
+  hasNameIndex() const noexcept
+  {
+    return m_hasNameIndex;
+  }
+
+  /** \brief Enable or disable the hash index on Data names.
+   *
+   *  Enabling the index builds it from the existing entries.
+   */
+  void
+  enableNameIndex(bool wantNameIndex);
+
 public: // enumeration
   using const_iterator = Table::const_iterator;
 
@@ -182,6 +230,20 @@ private:
   const_iterator
   findImpl(const Interest& interest) const;
 
+  /** \brief Find a match for an Interest without CanBePrefix, using the name index.
+   */
+  const_iterator
+  findExactMatch(const Interest& interest) const;
+
+  void
+  eraseEntry(const_iterator it);
+
+  void
+  addToNameIndex(const_iterator it);
+
+  void
+  removeFromNameIndex(const_iterator it);
+
   void
   setPolicyImpl(unique_ptr<Policy> policy);
 
@@ -192,6 +254,11 @@ private:
 
   bool m_shouldAdmit = true; ///< if false, no Data will be admitted
   bool m_shouldServe = true; ///< if false, all lookups will miss
+  size_t m_nBytes = 0; ///< total wire size of Data in m_table
+
+  /// hash of Data name => entry; populated only if m_hasNameIndex is true
+  std::unordered_multimap<name_tree::HashValue, const_iterator> m_nameIndex;
+  bool m_hasNameIndex = false;
 };
 
 } // namespace cs
@@ -28,6 +28,8 @@
 #include "common/global.hpp"
 #include "common/logger.hpp"
 
+#include <limits>
+
 namespace nfd {
 
 NFD_LOG_INIT(DeadNonceList);
@@ -42,8 +44,10 @@ DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
     NDN_THROW(std::invalid_argument("lifetime is less than MIN_LIFETIME"));
   }
 
+  m_buffer.resize(MIN_CAPACITY);
+  m_slots.resize(2 * MIN_CAPACITY);
   for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
-    m_queue.push_back(MARK);
+    pushBack(MARK);
   }
 
   m_markEvent = getScheduler().schedule(m_markInterval, [this] { mark(); });
@@ -59,35 +63,49 @@ DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
   BOOST_ASSERT_MSG(CAPACITY_UP > 1.0, "CAPACITY_UP must adjust up");
   BOOST_ASSERT_MSG(CAPACITY_DOWN < 1.0, "CAPACITY_DOWN must adjust down");
   static_assert(EVICT_LIMIT >= 1);
+  static_assert((MIN_CAPACITY & (MIN_CAPACITY - 1)) == 0, "MIN_CAPACITY must be a power of two");
+  // buffer positions plus one must fit in an index slot, including tombstones and evictions in progress
+  static_assert(MAX_CAPACITY < std::numeric_limits<uint32_t>::max() / 4);
 }
 
 size_t
 DeadNonceList::size() const
 {
-  return m_queue.size() - countMarks();
+  return m_bufferSize - m_nTombstones - countMarks();
 }
 
 bool
 DeadNonceList::has(const Name& name, Interest::Nonce nonce) const
 {
   Entry entry = DeadNonceList::makeEntry(name, nonce);
-  return m_ht.find(entry) != m_ht.end();
+  return findSlot(entry) != m_slots.size();
 }
 
 void
 DeadNonceList::add(const Name& name, Interest::Nonce nonce)
 {
   Entry entry = DeadNonceList::makeEntry(name, nonce);
-  const auto iter = m_ht.find(entry);
-  bool isDuplicate = iter != m_ht.end();
+  size_t slot = findSlot(entry);
+  bool isDuplicate = slot != m_slots.size();
 
   NFD_LOG_TRACE("adding " << (isDuplicate ? "duplicate " : "") << name << " nonce=" << nonce);
 
   if (isDuplicate) {
-    m_queue.relocate(m_queue.end(), m_index.project<Queue>(iter));
+    // move the entry to the back, keeping its old position as a tombstone
+    m_buffer[m_slots[slot] - 1] = TOMBSTONE;
+    ++m_nTombstones;
+    eraseSlot(slot);
+  }
+
+  size_t pos = pushBack(entry);
+  if (2 * (m_nIndexed + 1) > m_slots.size()) {
+    rebuildIndex(m_slots.size() * 2); // this also indexes the new entry
   }
   else {
-    m_queue.push_back(entry);
+    insertSlot(entry, pos);
+  }
+
+  if (!isDuplicate) {
     evictEntries();
   }
 }
@@ -104,13 +122,13 @@ DeadNonceList::makeEntry(const Name& name, Interest::Nonce nonce)
 size_t
 DeadNonceList::countMarks() const
 {
-  return m_ht.count(MARK);
+  return m_nMarks;
 }
 
 void
 DeadNonceList::mark()
 {
-  m_queue.push_back(MARK);
+  pushBack(MARK);
   size_t nMarks = countMarks();
   m_actualMarkCounts.insert(nMarks);
 
@@ -140,22 +158,167 @@ DeadNonceList::adjustCapacity()
   m_actualMarkCounts.clear();
   evictEntries();
 
+  // release memory if the buffer has become much larger than needed
+  size_t needed = std::max(m_bufferSize, m_capacity) + EVICT_LIMIT;
+  if (m_buffer.size() > 2 * needed && m_buffer.size() > MIN_CAPACITY) {
+    relocateBuffer(std::max(MIN_CAPACITY, needed + needed / 2));
+  }
+
   m_adjustCapacityEvent = getScheduler().schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
 }
 
 void
 DeadNonceList::evictEntries()
 {
-  if (m_queue.size() <= m_capacity) // not over capacity
+  size_t queueSize = m_bufferSize - m_nTombstones;
+  if (queueSize <= m_capacity) // not over capacity
     return;
 
-  auto nEvict = std::min(m_queue.size() - m_capacity, EVICT_LIMIT);
-  for (size_t i = 0; i < nEvict; i++) {
-    m_queue.pop_front();
+  auto nEvict = std::min(queueSize - m_capacity, EVICT_LIMIT);
+  for (size_t i = 0; i < nEvict; ) {
+    // tombstones are not counted, because they stand for entries that have been moved
+    if (popFront() != TOMBSTONE) {
+      ++i;
+    }
   }
-  BOOST_ASSERT(m_queue.size() >= m_capacity);
+  BOOST_ASSERT(m_bufferSize - m_nTombstones >= m_capacity);
 
   NFD_LOG_TRACE("evicted=" << nEvict << " size=" << size() << " capacity=" << m_capacity);
 }
 
+size_t
+DeadNonceList::pushBack(Entry entry)
+{
+  if (m_bufferSize == m_buffer.size()) {
+    // drop tombstones if there are many of them, otherwise grow the buffer
+    size_t newCapacity = m_nTombstones >= m_bufferSize / 4 ? m_buffer.size() : m_buffer.size() * 3 / 2;
+    relocateBuffer(newCapacity);
+  }
+
+  size_t pos = m_head + m_bufferSize;
+  if (pos >= m_buffer.size()) {
+    pos -= m_buffer.size();
+  }
+  m_buffer[pos] = entry;
+  ++m_bufferSize;
+  if (entry == MARK) {
+    ++m_nMarks;
+  }
+  return pos;
+}
+
+DeadNonceList::Entry
+DeadNonceList::popFront()
+{
+  BOOST_ASSERT(m_bufferSize > 0);
+  Entry entry = m_buffer[m_head];
+  if (entry == MARK) {
+    --m_nMarks;
+  }
+  else if (entry == TOMBSTONE) {
+    --m_nTombstones;
+  }
+  else {
+    size_t slot = findSlot(entry);
+    BOOST_ASSERT(slot != m_slots.size());
+    eraseSlot(slot);
+  }
+
+  if (++m_head == m_buffer.size()) {
+    m_head = 0;
+  }
+  --m_bufferSize;
+  return entry;
+}
+
+void
+DeadNonceList::relocateBuffer(size_t newCapacity)
+{
+  std::vector<Entry> buffer(newCapacity);
+  size_t n = 0;
+  for (size_t i = 0, pos = m_head; i < m_bufferSize; ++i) {
+    if (m_buffer[pos] != TOMBSTONE) {
+      buffer[n++] = m_buffer[pos];
+    }
+    if (++pos == m_buffer.size()) {
+      pos = 0;
+    }
+  }
+  BOOST_ASSERT(n <= newCapacity);
+
+  m_buffer.swap(buffer);
+  m_head = 0;
+  m_bufferSize = n;
+  m_nTombstones = 0;
+
+  // keep the index load factor at most 1/2, leaving room for the entry being added
+  size_t nSlots = MIN_CAPACITY;
+  while (nSlots < 2 * (m_bufferSize - m_nMarks + 1)) {
+    nSlots *= 2;
+  }
+  rebuildIndex(nSlots);
+
+  NFD_LOG_TRACE("relocated buffer capacity=" << m_buffer.size() << " slots=" << m_slots.size());
+}
+
+size_t
+DeadNonceList::findSlot(Entry entry) const
+{
+  size_t mask = m_slots.size() - 1;
+  for (size_t slot = entry & mask; m_slots[slot] != 0; slot = (slot + 1) & mask) {
+    if (m_buffer[m_slots[slot] - 1] == entry) {
+      return slot;
+    }
+  }
+  return m_slots.size();
+}
+
+void
+DeadNonceList::insertSlot(Entry entry, size_t pos)
+{
+  BOOST_ASSERT(2 * (m_nIndexed + 1) <= m_slots.size());
+
+  size_t mask = m_slots.size() - 1;
+  size_t slot = entry & mask;
+  while (m_slots[slot] != 0) {
+    slot = (slot + 1) & mask;
+  }
+  m_slots[slot] = static_cast<uint32_t>(pos + 1);
+  ++m_nIndexed;
+}
+
+void
+DeadNonceList::eraseSlot(size_t slot)
+{
+  size_t mask = m_slots.size() - 1;
+  for (size_t next = (slot + 1) & mask; m_slots[next] != 0; next = (next + 1) & mask) {
+    // the entry at next can fill the hole if its home slot is not within (slot, next]
+    size_t home = m_buffer[m_slots[next] - 1] & mask;
+    if (((next - home) & mask) >= ((next - slot) & mask)) {
+      m_slots[slot] = m_slots[next];
+      slot = next;
+    }
+  }
+  m_slots[slot] = 0;
+  --m_nIndexed;
+}
+
+void
+DeadNonceList::rebuildIndex(size_t nSlots)
+{
+  BOOST_ASSERT((nSlots & (nSlots - 1)) == 0);
+  m_slots.assign(nSlots, 0);
+  m_nIndexed = 0;
+
+  for (size_t i = 0, pos = m_head; i < m_bufferSize; ++i) {
+    Entry entry = m_buffer[pos];
+    if (entry != MARK && entry != TOMBSTONE) {
+      insertSlot(entry, pos);
+    }
+    if (++pos == m_buffer.size()) {
+      pos = 0;
+    }
+  }
+}
+
 } // namespace nfd
@@ -30,9 +30,7 @@
 
 #include <ndn-cxx/util/scheduler.hpp>
 
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/sequenced_index.hpp>
+#include <set>
 
 namespace nfd {
 
@@ -47,6 +45,12 @@ namespace nfd {
  * The probability of false positives (a non-looping Interest considered as looping) is small
  * and a collision is recoverable when the consumer retransmits with a different Nonce.
  *
+ * Entries are stored in a circular buffer in insertion order, and located through an
+ * open-addressing index of buffer positions. Each entry costs 8 bytes in the buffer plus
+ * 4 bytes per index slot, about 16 bytes in total, without any per-entry heap allocation.
+ * Re-adding an existing entry leaves a tombstone at its old position, which is discarded
+ * when it reaches the front of the buffer or when the buffer is compacted.
+ *
  * To reduce memory usage, entries do not have associated timestamps. Instead, the lifetime
  * of the entries is controlled by dynamically adjusting the capacity of the container.
  * At fixed intervals, a MARK (an entry with a special value) is inserted into the container.
@@ -124,6 +128,48 @@ private:
   void
   evictEntries();
 
+  // ---- circular buffer
+
+  /** \brief Append \p entry to the buffer
+   *  \return position of the entry in the buffer
+   */
+  size_t
+  pushBack(Entry entry);
+
+  /** \brief Remove the oldest entry, MARK, or tombstone from the buffer
+   */
+  Entry
+  popFront();
+
+  /** \brief Move live entries and MARKs into a new buffer of \p newCapacity, dropping
+   *         tombstones, then rebuild the index
+   */
+  void
+  relocateBuffer(size_t newCapacity);
+
+  // ---- index
+
+  /** \return index slot pointing at \p entry, or m_slots.size() if \p entry does not exist
+   */
+  size_t
+  findSlot(Entry entry) const;
+
+  /** \brief Index \p entry stored at buffer position \p pos
+   *  \pre the index has room for another entry at a load factor of 1/2
+   */
+  void
+  insertSlot(Entry entry, size_t pos);
+
+  /** \brief Remove an index slot with backward-shift deletion
+   */
+  void
+  eraseSlot(size_t slot);
+
+  /** \brief Reallocate the index with \p nSlots slots and insert every live entry
+   */
+  void
+  rebuildIndex(size_t nSlots);
+
 public:
   /// Default entry lifetime
   static constexpr time::nanoseconds DEFAULT_LIFETIME = 6_s;
@@ -133,20 +179,23 @@ public:
 private:
   const time::nanoseconds m_lifetime;
 
-  struct Queue {};
-  struct Hashtable {};
-  using Container = boost::multi_index_container<
-    Entry,
-    boost::multi_index::indexed_by<
-      boost::multi_index::sequenced<boost::multi_index::tag<Queue>>,
-      boost::multi_index::hashed_non_unique<boost::multi_index::tag<Hashtable>,
-                                            boost::multi_index::identity<Entry>>
-    >
-  >;
-
-  Container m_index;
-  Container::index<Queue>::type& m_queue = m_index.get<Queue>();
-  Container::index<Hashtable>::type& m_ht = m_index.get<Hashtable>();
+  /** \brief Circular buffer of entries, MARKs, and tombstones in insertion order
+   *
+   *  The occupied positions are m_head, m_head+1, ..., m_head+m_bufferSize-1, modulo m_buffer.size().
+   */
+  std::vector<Entry> m_buffer;
+  size_t m_head = 0;
+  size_t m_bufferSize = 0;
+  size_t m_nMarks = 0;
+  size_t m_nTombstones = 0;
+
+  /** \brief Open-addressing index with linear probing
+   *
+   *  Each slot contains a buffer position plus one, or zero if the slot is empty.
+   *  The number of slots is a power of two.
+   */
+  std::vector<uint32_t> m_slots;
+  size_t m_nIndexed = 0;
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
@@ -185,6 +234,12 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
    */
   static constexpr Entry MARK = 0;
 
+  /** \brief Placeholder for an entry that has been moved to the back of the buffer
+   *
+   *  Like MARK, it is infeasible to craft a "normal" Entry that collides with the TOMBSTONE.
+   */
+  static constexpr Entry TOMBSTONE = 1;
+
   /// Expected number of MARKs in the index
   static constexpr size_t EXPECTED_MARK_COUNT = 5;
 
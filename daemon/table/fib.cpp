@@ -53,6 +53,29 @@ Fib::findLongestPrefixMatchImpl(const K& key) const
   return *s_emptyEntry;
 }
 
+template<typename EntryT>
+const Entry&
+Fib::findLongestPrefixMatchCached(const EntryT& tableEntry) const
+{
+  const name_tree::Entry* nte = m_nameTree.getEntry(tableEntry);
+  BOOST_ASSERT(nte != nullptr);
+
+  if (nte->getName().size() < tableEntry.getName().size()) {
+    // the name tree entry is shared with shorter names and the lookup may go deeper, so
+    // the result is specific to this table entry and cannot be cached on the name tree entry
+    return this->findLongestPrefixMatchImpl(tableEntry);
+  }
+
+  auto& cache = nte->getFibCache();
+  if (const Entry* entry = cache.get(m_generation); entry != nullptr) {
+    return *entry;
+  }
+
+  const Entry& entry = this->findLongestPrefixMatchImpl(tableEntry);
+  cache.set(&entry, m_generation);
+  return entry;
+}
+
 const Entry&
 Fib::findLongestPrefixMatch(const Name& prefix) const
 {
@@ -62,13 +85,13 @@ Fib::findLongestPrefixMatch(const Name& prefix) const
 const Entry&
 Fib::findLongestPrefixMatch(const pit::Entry& pitEntry) const
 {
-  return this->findLongestPrefixMatchImpl(pitEntry);
+  return this->findLongestPrefixMatchCached(pitEntry);
 }
 
 const Entry&
 Fib::findLongestPrefixMatch(const measurements::Entry& measurementsEntry) const
 {
-  return this->findLongestPrefixMatchImpl(measurementsEntry);
+  return this->findLongestPrefixMatchCached(measurementsEntry);
 }
 
 Entry*
@@ -92,6 +115,7 @@ Fib::insert(const Name& prefix)
 
   nte.setFibEntry(make_unique<Entry>(prefix));
   ++m_nItems;
+  ++m_generation;
   return {nte.getFibEntry(), true};
 }
 
@@ -105,6 +129,7 @@ Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
     m_nameTree.eraseIfEmpty(nte);
   }
   --m_nItems;
+  ++m_generation;
 }
 
 void
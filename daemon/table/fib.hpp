@@ -160,6 +160,13 @@ private:
   const Entry&
   findLongestPrefixMatchImpl(const K& key) const;
 
+  /** \brief Longest prefix match for a table entry, memoized on its name tree entry
+   *  \tparam EntryT \c pit::Entry or \c measurements::Entry
+   */
+  template<typename EntryT>
+  const Entry&
+  findLongestPrefixMatchCached(const EntryT& tableEntry) const;
+
   void
   erase(name_tree::Entry* nte, bool canDeleteNte = true);
 
@@ -169,6 +176,8 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems = 0;
+  /// incremented whenever an entry is inserted or erased, invalidating cached lookups
+  uint64_t m_generation = 1;
 
   /** \brief The empty FIB entry.
    *
@@ -49,7 +49,8 @@ Measurements::get(name_tree::Entry& nte)
   entry = nte.getMeasurementsEntry();
 
   entry->m_expiry = time::steady_clock::now() + getInitialLifetime();
-  entry->m_cleanup = getScheduler().schedule(getInitialLifetime(), [=] { cleanup(*entry); });
+  entry->m_cleanup.setCallback([this, entry] { cleanup(*entry); });
+  getTimerWheel().schedule(entry->m_cleanup, getInitialLifetime());
 
   return *entry;
 }
@@ -133,9 +134,8 @@ Measurements::extendLifetime(Entry& entry, const time::nanoseconds& lifetime)
     return;
   }
 
-  entry.m_cleanup.cancel();
   entry.m_expiry = expiry;
-  entry.m_cleanup = getScheduler().schedule(lifetime, [&] { cleanup(entry); });
+  getTimerWheel().schedule(entry.m_cleanup, lifetime);
 }
 
 void
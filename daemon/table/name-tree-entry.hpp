@@ -35,6 +35,37 @@ namespace nfd::name_tree {
 
 class Node;
 
+/** \brief Caches the result of a longest prefix match that starts at a name tree entry.
+ *
+ *  A cached value is valid only while the owning table's generation number equals the
+ *  generation it was stored with. Tables bump their generation on every insertion or
+ *  deletion that could change a longest prefix match result.
+ *  \tparam T type of the looked up object, such as \c fw::Strategy
+ */
+template<typename T>
+class LpmCache
+{
+public:
+  /** \return the cached value, or nullptr if it was stored with a different generation
+   */
+  T*
+  get(uint64_t generation) const noexcept
+  {
+    return m_generation == generation ? m_value : nullptr;
+  }
+
+  void
+  set(T* value, uint64_t generation) noexcept
+  {
+    m_value = value;
+    m_generation = generation;
+  }
+
+private:
+  T* m_value = nullptr;
+  uint64_t m_generation = 0;
+};
+
 /**
  * \brief An entry in the name tree.
  */
@@ -153,6 +184,23 @@ public: // attached table entries
   void
   setStrategyChoiceEntry(unique_ptr<strategy_choice::Entry> strategyChoiceEntry);
 
+public: // cached lookup results
+  /** \brief Cache of Fib::findLongestPrefixMatch for table entries attached to this entry
+   */
+  LpmCache<const fib::Entry>&
+  getFibCache() const noexcept
+  {
+    return m_fibCache;
+  }
+
+  /** \brief Cache of StrategyChoice::findEffectiveStrategy for table entries attached to this entry
+   */
+  LpmCache<fw::Strategy>&
+  getStrategyCache() const noexcept
+  {
+    return m_strategyCache;
+  }
+
   /** \return name tree entry on which a table entry is attached,
    *          or nullptr if the table entry is detached
    *  \note This function is for NameTree internal use. Other components
@@ -176,6 +224,9 @@ private:
   unique_ptr<measurements::Entry> m_measurementsEntry;
   unique_ptr<strategy_choice::Entry> m_strategyChoiceEntry;
 
+  mutable LpmCache<const fib::Entry> m_fibCache;
+  mutable LpmCache<fw::Strategy> m_strategyCache;
+
   friend Node* getNode(const Entry& entry);
 };
 
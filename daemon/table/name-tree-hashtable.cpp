@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2024,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,6 +26,14 @@
 #include "name-tree-hashtable.hpp"
 #include "common/city-hash.hpp"
 #include "common/logger.hpp"
+#include "common/memory-pool.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define NFD_NAME_TREE_HAVE_SSE42
+#include <nmmintrin.h>
+#endif
 
 namespace nfd::name_tree {
 
@@ -56,39 +64,227 @@ public:
  */
 using HashFunc = std::conditional_t<(sizeof(HashValue) > 4), Hash64, Hash32>;
 
-HashValue
-computeHash(const Name& name, size_t prefixLen)
-{
-  name.wireEncode(); // ensure wire buffer exists
+/** \brief Hashes name components [0, last) of \p name.
+ *  \param seq if not nullptr, receives the hash value of each prefix, including the empty prefix
+ *  \return hash value of name.getPrefix(last)
+ */
+using KernelFunc = HashValue (*)(const Name& name, size_t last, HashSequence* seq);
 
+static HashValue
+computeScalar(const Name& name, size_t last, HashSequence* seq)
+{
   HashValue h = 0;
-  for (size_t i = 0, last = std::min(prefixLen, name.size()); i < last; ++i) {
+  if (seq != nullptr) {
+    seq->push_back(h);
+  }
+
+  for (size_t i = 0; i < last; ++i) {
     const name::Component& comp = name[i];
     h ^= HashFunc::compute(comp.data(), comp.size());
+    if (seq != nullptr) {
+      seq->push_back(h);
+    }
   }
   return h;
 }
 
-HashSequence
-computeHashes(const Name& name, size_t prefixLen)
+#ifdef NFD_NAME_TREE_HAVE_SSE42
+static uint64_t
+loadWord(const uint8_t* p)
 {
-  name.wireEncode(); // ensure wire buffer exists
+  uint64_t word;
+  std::memcpy(&word, p, sizeof(word));
+  return word;
+}
 
-  size_t last = std::min(prefixLen, name.size());
-  HashSequence seq;
-  seq.reserve(last + 1);
+/** \brief Loads the last \p rem bytes of a component of size \p size, where `0 < rem < 8`.
+ *
+ *  The loads never go past the end of the component. When `size >= 8`, the 8 bytes ending at
+ *  `p + rem` are loaded and the already hashed bytes are shifted out (x86 is little-endian).
+ */
+static uint64_t
+loadTail(const uint8_t* p, size_t rem, size_t size)
+{
+  if (size >= 8) {
+    return loadWord(p + rem - 8) >> (8 * (8 - rem));
+  }
+  if (rem >= 4) {
+    uint32_t lo, hi;
+    std::memcpy(&lo, p, sizeof(lo));
+    std::memcpy(&hi, p + rem - 4, sizeof(hi));
+    return lo | (uint64_t{hi} << 32);
+  }
+  return p[0] | (uint64_t{p[rem / 2]} << 8) | (uint64_t{p[rem - 1]} << 16);
+}
 
+/** \brief Hashes one component with CRC32C.
+ *
+ *  CRC is linear, so a plain CRC of each component would make the XOR of component hashes
+ *  prone to structured collisions. Two CRC32C streams (the second over word-rotated input) give
+ *  64 bits of state, which are then combined with the length and avalanched with the MurmurHash3
+ *  finalizer to break the linearity.
+ */
+[[gnu::target("sse4.2")]] static uint64_t
+hashComponentSse42(const uint8_t* p, size_t size)
+{
+  uint64_t a = 0;
+  uint64_t b = 0x9ae16a3bU;
+  size_t rem = size;
+  for (; rem >= 8; rem -= 8, p += 8) {
+    uint64_t word = loadWord(p);
+    a = _mm_crc32_u64(a, word);
+    b = _mm_crc32_u64(b, (word >> 32) | (word << 32));
+  }
+  if (rem > 0) {
+    uint64_t word = loadTail(p, rem, size);
+    a = _mm_crc32_u64(a, word);
+    b = _mm_crc32_u64(b, (word >> 32) | (word << 32));
+  }
+
+  uint64_t h = ((b << 32) | a) ^ (size * 0x9ddfea08eb382d69ULL);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+[[gnu::target("sse4.2")]] static HashValue
+computeSse42(const Name& name, size_t last, HashSequence* seq)
+{
   HashValue h = 0;
-  seq.push_back(h);
+  if (seq != nullptr) {
+    seq->push_back(h);
+  }
 
   for (size_t i = 0; i < last; ++i) {
     const name::Component& comp = name[i];
-    h ^= HashFunc::compute(comp.data(), comp.size());
-    seq.push_back(h);
+    h ^= static_cast<HashValue>(hashComponentSse42(comp.data(), comp.size()));
+    if (seq != nullptr) {
+      seq->push_back(h);
+    }
+  }
+  return h;
+}
+#endif // NFD_NAME_TREE_HAVE_SSE42
+
+std::ostream&
+operator<<(std::ostream& os, HashKernel kernel)
+{
+  switch (kernel) {
+    case HashKernel::SCALAR:
+      return os << "scalar";
+    case HashKernel::SSE42:
+      return os << "sse4.2";
   }
+  return os << "none";
+}
+
+bool
+isHashKernelSupported(HashKernel kernel)
+{
+  switch (kernel) {
+    case HashKernel::SCALAR:
+      return true;
+    case HashKernel::SSE42:
+#ifdef NFD_NAME_TREE_HAVE_SSE42
+      return __builtin_cpu_supports("sse4.2");
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+static KernelFunc
+getKernelFunc(HashKernel kernel)
+{
+  BOOST_ASSERT(isHashKernelSupported(kernel));
+  switch (kernel) {
+    case HashKernel::SCALAR:
+      break;
+    case HashKernel::SSE42:
+#ifdef NFD_NAME_TREE_HAVE_SSE42
+      return &computeSse42;
+#else
+      break;
+#endif
+  }
+  return &computeScalar;
+}
+
+HashKernel
+getHashKernel()
+{
+  static const HashKernel kernel = [] {
+    auto k = isHashKernelSupported(HashKernel::SSE42) ? HashKernel::SSE42 : HashKernel::SCALAR;
+    NFD_LOG_DEBUG("hash kernel " << k);
+    return k;
+  }();
+  return kernel;
+}
+
+static KernelFunc
+getSelectedKernelFunc()
+{
+  static const KernelFunc func = getKernelFunc(getHashKernel());
+  return func;
+}
+
+HashValue
+computeHash(const Name& name, size_t prefixLen)
+{
+  name.wireEncode(); // ensure wire buffer exists
+
+  return getSelectedKernelFunc()(name, std::min(prefixLen, name.size()), nullptr);
+}
+
+static HashSequence
+computeHashesWith(KernelFunc func, const Name& name, size_t prefixLen)
+{
+  name.wireEncode(); // ensure wire buffer exists
+
+  size_t last = std::min(prefixLen, name.size());
+  BOOST_ASSERT(last < HashSequence::static_capacity);
+  HashSequence seq;
+  func(name, last, &seq);
   return seq;
 }
 
+HashSequence
+computeHashes(const Name& name, size_t prefixLen)
+{
+  return computeHashesWith(getSelectedKernelFunc(), name, prefixLen);
+}
+
+HashSequence
+computeHashes(const Name& name, size_t prefixLen, HashKernel kernel)
+{
+  return computeHashesWith(getKernelFunc(kernel), name, prefixLen);
+}
+
+const HashSequence&
+getHashes(const Interest& interest)
+{
+  const Name& name = interest.getName();
+  const Block& wire = name.wireEncode();
+
+  auto tag = interest.getTag<HashSequenceTag>();
+  if (tag == nullptr || tag->nameWire.data() != wire.data() || tag->nameWire.size() != wire.size()) {
+    tag = make_shared<HashSequenceTag>(wire, computeHashes(name, HashSequence::static_capacity - 1));
+    interest.setTag(tag);
+  }
+  // the packet holds a reference to the tag, so the returned reference remains valid
+  return tag->hashes;
+}
+
+HashSequence
+getHashes(const Data& data)
+{
+  return computeHashes(data.getName(), HashSequence::static_capacity - 1);
+}
+
 Node::Node(HashValue h, const Name& name)
   : hash(h)
   , prev(nullptr)
@@ -103,12 +299,43 @@ Node::~Node()
   BOOST_ASSERT(next == nullptr);
 }
 
+/** \brief Identifies the MemoryPool of name tree nodes.
+ */
+struct NodePoolTag
+{
+  static constexpr const char* POOL_NAME = "name-tree-node";
+};
+
+void*
+Node::operator new(size_t size)
+{
+  return getMemoryPool<NodePoolTag>().allocate(size);
+}
+
+void
+Node::operator delete(void* ptr, size_t size) noexcept
+{
+  getMemoryPool<NodePoolTag>().deallocate(ptr, size);
+}
+
 Node*
 getNode(const Entry& entry)
 {
   return entry.m_node;
 }
 
+std::ostream&
+operator<<(std::ostream& os, HashtableMode mode)
+{
+  switch (mode) {
+    case HashtableMode::CHAINING:
+      return os << "chaining";
+    case HashtableMode::OPEN_ADDRESSING:
+      return os << "open-addressing";
+  }
+  return os << "none";
+}
+
 HashtableOptions::HashtableOptions(size_t size)
   : initialSize(size)
   , minSize(size)
@@ -128,45 +355,53 @@ Hashtable::Hashtable(const Options& options)
   BOOST_ASSERT(m_options.shrinkLoadFactor < 1.0);
   BOOST_ASSERT(m_options.shrinkFactor > 0.0);
   BOOST_ASSERT(m_options.shrinkFactor < 1.0);
+  BOOST_ASSERT(m_options.mode != HashtableMode::OPEN_ADDRESSING ||
+               (m_options.expandLoadFactor < 1.0 &&
+                m_options.shrinkLoadFactor < m_options.shrinkFactor));
 
-  m_buckets.resize(options.initialSize);
+  m_table.nodes.resize(options.initialSize);
+  if (m_options.mode == HashtableMode::OPEN_ADDRESSING) {
+    m_table.slots.resize(options.initialSize);
+  }
   this->computeThresholds();
 }
 
 Hashtable::~Hashtable()
 {
-  for (size_t i = 0; i < m_buckets.size(); ++i) {
-    foreachNode(m_buckets[i], [] (Node* node) {
-      node->prev = node->next = nullptr;
-      delete node;
-    });
+  for (BucketArray* table : {&m_table, &m_oldTable}) {
+    for (Node* head : table->nodes) {
+      foreachNode(head, [] (Node* node) {
+        node->prev = node->next = nullptr;
+        delete node;
+      });
+    }
   }
 }
 
 void
-Hashtable::attach(size_t bucket, Node* node)
+Hashtable::attach(BucketArray& table, size_t bucket, Node* node)
 {
   node->prev = nullptr;
-  node->next = m_buckets[bucket];
+  node->next = table.nodes[bucket];
 
   if (node->next != nullptr) {
     BOOST_ASSERT(node->next->prev == nullptr);
     node->next->prev = node;
   }
 
-  m_buckets[bucket] = node;
+  table.nodes[bucket] = node;
 }
 
 void
-Hashtable::detach(size_t bucket, Node* node)
+Hashtable::detach(BucketArray& table, size_t bucket, Node* node)
 {
   if (node->prev != nullptr) {
     BOOST_ASSERT(node->prev->next == node);
     node->prev->next = node->next;
   }
   else {
-    BOOST_ASSERT(m_buckets[bucket] == node);
-    m_buckets[bucket] = node->next;
+    BOOST_ASSERT(table.nodes[bucket] == node);
+    table.nodes[bucket] = node->next;
   }
 
   if (node->next != nullptr) {
@@ -177,16 +412,167 @@ Hashtable::detach(size_t bucket, Node* node)
   node->prev = node->next = nullptr;
 }
 
+const Node*
+Hashtable::findOpen(const BucketArray& table, const Name& name, size_t prefixLen, HashValue h,
+                    size_t& bucket, Slot& probe)
+{
+  // Robin Hood invariant: the probe can stop at the first bucket that is either empty
+  // or holds a node closer to its home bucket than the sought node would be
+  for (; table.slots[bucket].distance >= probe.distance; bucket = table.next(bucket), ++probe.distance) {
+    const Slot& slot = table.slots[bucket];
+    if (slot.distance != probe.distance || slot.fingerprint != probe.fingerprint) {
+      continue;
+    }
+    const Node* node = table.nodes[bucket];
+    if (node != nullptr && node->hash == h && name.compare(0, prefixLen, node->entry.getName()) == 0) {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
+void
+Hashtable::placeOpen(BucketArray& table, size_t bucket, Slot slot, Node* node)
+{
+  for (; table.slots[bucket].distance != 0; bucket = table.next(bucket), ++slot.distance) {
+    if (table.slots[bucket].distance < slot.distance) {
+      std::swap(table.slots[bucket], slot);
+      std::swap(table.nodes[bucket], node);
+    }
+  }
+
+  table.slots[bucket] = slot;
+  table.nodes[bucket] = node;
+}
+
+void
+Hashtable::removeOpen(BucketArray& table, size_t bucket)
+{
+  for (size_t next = table.next(bucket); table.slots[next].distance > 1;
+       bucket = next, next = table.next(next)) {
+    table.slots[bucket] = table.slots[next];
+    --table.slots[bucket].distance;
+    table.nodes[bucket] = table.nodes[next];
+  }
+
+  table.slots[bucket] = Slot{};
+  table.nodes[bucket] = nullptr;
+}
+
+std::pair<bool, size_t>
+Hashtable::locate(const Node& node) const
+{
+  size_t bucket = m_table.computeIndex(node.hash);
+
+  if (m_options.mode == HashtableMode::OPEN_ADDRESSING) {
+    for (uint32_t distance = 1; m_table.slots[bucket].distance >= distance;
+         bucket = m_table.next(bucket), ++distance) {
+      if (m_table.nodes[bucket] == &node) {
+        return {false, bucket};
+      }
+    }
+    BOOST_ASSERT(this->isResizing());
+    bucket = m_oldTable.computeIndex(node.hash);
+    while (m_oldTable.nodes[bucket] != &node) {
+      BOOST_ASSERT(m_oldTable.slots[bucket].distance != 0);
+      bucket = m_oldTable.next(bucket);
+    }
+    return {true, bucket};
+  }
+
+  if (!this->isResizing()) {
+    return {false, bucket};
+  }
+  size_t oldBucket = m_oldTable.computeIndex(node.hash);
+  if (oldBucket < m_nMigratedBuckets) {
+    return {false, bucket};
+  }
+  // the node is in one of two chains; the head of its chain tells which
+  const Node* head = &node;
+  while (head->prev != nullptr) {
+    head = head->prev;
+  }
+  return head == m_table.nodes[bucket] ? std::pair(false, bucket) : std::pair(true, oldBucket);
+}
+
+const Node*
+Hashtable::getNextNode(const Node* node) const
+{
+  // position in the concatenation of the current and old bucket arrays
+  size_t pos = 0;
+  if (node != nullptr) {
+    if (node->next != nullptr) {
+      return node->next;
+    }
+    auto [isOld, bucket] = this->locate(*node);
+    pos = bucket + 1 + (isOld ? this->getNBuckets() : 0);
+  }
+
+  for (; pos < this->getNBuckets(); ++pos) {
+    if (m_table.nodes[pos] != nullptr) {
+      return m_table.nodes[pos];
+    }
+  }
+  for (pos -= this->getNBuckets(); pos < m_oldTable.nodes.size(); ++pos) {
+    if (m_oldTable.nodes[pos] != nullptr) {
+      return m_oldTable.nodes[pos];
+    }
+  }
+  return nullptr;
+}
+
+const Node*
+Hashtable::findOld(const Name& name, size_t prefixLen, HashValue h) const
+{
+  BOOST_ASSERT(this->isResizing());
+  size_t bucket = m_oldTable.computeIndex(h);
+
+  if (m_options.mode == HashtableMode::OPEN_ADDRESSING) {
+    Slot probe{computeFingerprint(h), 1};
+    return findOpen(m_oldTable, name, prefixLen, h, bucket, probe);
+  }
+
+  if (bucket < m_nMigratedBuckets) {
+    return nullptr;
+  }
+  for (const Node* node = m_oldTable.nodes[bucket]; node != nullptr; node = node->next) {
+    if (node->hash == h && name.compare(0, prefixLen, node->entry.getName()) == 0) {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
 std::pair<const Node*, bool>
 Hashtable::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert)
 {
   size_t bucket = this->computeBucketIndex(h);
+  Slot probe{computeFingerprint(h), 1};
+  const Node* found = nullptr;
 
-  for (const Node* node = m_buckets[bucket]; node != nullptr; node = node->next) {
-    if (node->hash == h && name.compare(0, prefixLen, node->entry.getName()) == 0) {
-      NFD_LOG_TRACE("found " << name.getPrefix(prefixLen) << " hash=" << h << " bucket=" << bucket);
-      return {node, false};
+  if (m_options.mode == HashtableMode::OPEN_ADDRESSING) {
+    // if not found, insertion starts at the bucket where the probe stopped
+    found = findOpen(m_table, name, prefixLen, h, bucket, probe);
+  }
+  else {
+    for (const Node* node = m_table.nodes[bucket]; node != nullptr; node = node->next) {
+      if (node->hash == h && name.compare(0, prefixLen, node->entry.getName()) == 0) {
+        found = node;
+        break;
+      }
+    }
+  }
+
+  if (found == nullptr && this->isResizing()) {
+    found = this->findOld(name, prefixLen, h);
+  }
+
+  if (found != nullptr) {
+    NFD_LOG_TRACE("found " << name.getPrefix(prefixLen) << " hash=" << h << " bucket=" << bucket);
+    if (allowInsert && this->isResizing()) {
+      this->migrate(m_options.resizeStep);
     }
+    return {found, false};
   }
 
   if (!allowInsert) {
@@ -195,13 +581,21 @@ Hashtable::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool al
   }
 
   Node* node = new Node(h, name.getPrefix(prefixLen));
-  this->attach(bucket, node);
+  if (m_options.mode == HashtableMode::OPEN_ADDRESSING) {
+    placeOpen(m_table, bucket, probe, node);
+  }
+  else {
+    attach(m_table, bucket, node);
+  }
   NFD_LOG_TRACE("insert " << node->entry.getName() << " hash=" << h << " bucket=" << bucket);
   ++m_size;
 
   if (m_size > m_expandThreshold) {
     this->resize(static_cast<size_t>(m_options.expandFactor * this->getNBuckets()));
   }
+  if (this->isResizing()) {
+    this->migrate(m_options.resizeStep);
+  }
 
   return {node, true};
 }
@@ -233,10 +627,20 @@ Hashtable::erase(Node* node)
   BOOST_ASSERT(node != nullptr);
   BOOST_ASSERT(node->entry.getParent() == nullptr);
 
-  size_t bucket = this->computeBucketIndex(node->hash);
-  NFD_LOG_TRACE("erase " << node->entry.getName() << " hash=" << node->hash << " bucket=" << bucket);
+  auto [isOld, bucket] = this->locate(*node);
+  NFD_LOG_TRACE("erase " << node->entry.getName() << " hash=" << node->hash <<
+                (isOld ? " old-bucket=" : " bucket=") << bucket);
 
-  this->detach(bucket, node);
+  BucketArray& table = isOld ? m_oldTable : m_table;
+  if (m_options.mode != HashtableMode::OPEN_ADDRESSING) {
+    detach(table, bucket, node);
+  }
+  else if (isOld) {
+    table.nodes[bucket] = nullptr; // keep the Slot so that other probe runs stay intact
+  }
+  else {
+    removeOpen(table, bucket);
+  }
   delete node;
   --m_size;
 
@@ -245,6 +649,9 @@ Hashtable::erase(Node* node)
       static_cast<size_t>(m_options.shrinkFactor * this->getNBuckets()));
     this->resize(newNBuckets);
   }
+  if (this->isResizing()) {
+    this->migrate(m_options.resizeStep);
+  }
 }
 
 void
@@ -261,20 +668,52 @@ Hashtable::resize(size_t newNBuckets)
   if (this->getNBuckets() == newNBuckets) {
     return;
   }
-  NFD_LOG_DEBUG("resize from=" << this->getNBuckets() << " to=" << newNBuckets);
 
-  std::vector<Node*> oldBuckets;
-  oldBuckets.swap(m_buckets);
-  m_buckets.resize(newNBuckets);
+  if (this->isResizing()) {
+    this->migrate(std::numeric_limits<size_t>::max());
+  }
+  NFD_LOG_DEBUG("resize from=" << this->getNBuckets() << " to=" << newNBuckets);
 
-  for (Node* head : oldBuckets) {
-    foreachNode(head, [this] (Node* node) {
-      size_t bucket = this->computeBucketIndex(node->hash);
-      this->attach(bucket, node);
-    });
+  m_oldTable = std::exchange(m_table, BucketArray{});
+  m_table.nodes.resize(newNBuckets);
+  if (m_options.mode == HashtableMode::OPEN_ADDRESSING) {
+    m_table.slots.resize(newNBuckets);
   }
+  m_nMigratedBuckets = 0;
 
   this->computeThresholds();
 }
 
+void
+Hashtable::migrate(size_t maxBuckets)
+{
+  BOOST_ASSERT(this->isResizing());
+  size_t nOldBuckets = m_oldTable.nodes.size();
+  size_t end = maxBuckets == 0 || nOldBuckets - m_nMigratedBuckets <= maxBuckets ?
+               nOldBuckets : m_nMigratedBuckets + maxBuckets;
+
+  for (; m_nMigratedBuckets < end; ++m_nMigratedBuckets) {
+    Node*& head = m_oldTable.nodes[m_nMigratedBuckets];
+    if (m_options.mode == HashtableMode::OPEN_ADDRESSING) {
+      if (head != nullptr) {
+        placeOpen(m_table, this->computeBucketIndex(head->hash),
+                  Slot{computeFingerprint(head->hash), 1}, head);
+      }
+    }
+    else {
+      foreachNode(head, [this] (Node* node) {
+        attach(m_table, this->computeBucketIndex(node->hash), node);
+      });
+    }
+    head = nullptr;
+  }
+  ++m_nResizeSteps;
+
+  if (m_nMigratedBuckets == nOldBuckets) {
+    NFD_LOG_DEBUG("resize complete nBuckets=" << this->getNBuckets() << " steps=" << m_nResizeSteps);
+    m_oldTable = BucketArray{};
+    m_nMigratedBuckets = 0;
+  }
+}
+
 } // namespace nfd::name_tree
@@ -30,6 +30,8 @@
 
 #include <limits>
 
+#include <boost/container/static_vector.hpp>
+
 namespace nfd::name_tree {
 
 class Entry;
@@ -39,9 +41,12 @@ class Entry;
 using HashValue = size_t;
 
 /** \brief A sequence of hash values.
+ *
+ *  The hash values are stored inline, so that computing a sequence does not allocate memory.
+ *  The capacity covers every prefix of a name with up to NameTree::getMaxDepth() components.
  *  \sa computeHashes
  */
-using HashSequence = std::vector<HashValue>;
+using HashSequence = boost::container::static_vector<HashValue, 33>;
 
 /** \brief Computes hash value of \p name.getPrefix(prefixLen).
  */
@@ -50,14 +55,104 @@ computeHash(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::ma
 
 /** \brief Computes hash values for each prefix of \p name.getPrefix(prefixLen).
  *  \return a hash sequence, where the i-th hash value equals computeHash(name, i)
+ *  \pre `std::min(prefixLen, name.size()) < HashSequence::static_capacity`
  */
 HashSequence
 computeHashes(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max());
 
+/** \brief Implementation of name component hashing.
+ *
+ *  Every kernel computes the hash of a prefix as the XOR of its component hashes, but the
+ *  component hashes differ between kernels. Therefore, all hash values within a process must
+ *  come from the same kernel, which is selected by getHashKernel().
+ */
+enum class HashKernel {
+  /// CityHash over each component, one call per component. Available on every platform.
+  SCALAR,
+  /// CRC32C instructions over 8-byte words of each component, followed by a 64-bit finalizer.
+  /// Requires an x86-64 processor with SSE4.2.
+  SSE42,
+};
+
+std::ostream&
+operator<<(std::ostream& os, HashKernel kernel);
+
+/** \return whether \p kernel can run on this processor
+ */
+bool
+isHashKernelSupported(HashKernel kernel);
+
+/** \return the kernel used by computeHash, computeHashes, and getHashes
+ *
+ *  The fastest kernel supported by the processor is selected on first use, and stays in effect
+ *  for the lifetime of the process.
+ */
+HashKernel
+getHashKernel();
+
+/** \brief Computes hash values for each prefix of \p name.getPrefix(prefixLen) with \p kernel.
+ *  \pre isHashKernelSupported(kernel)
+ *  \pre `std::min(prefixLen, name.size()) < HashSequence::static_capacity`
+ *  \note This overload is intended for tests and benchmarks. Its result is comparable to the
+ *        other hash functions only if \p kernel equals getHashKernel().
+ */
+HashSequence
+computeHashes(const Name& name, size_t prefixLen, HashKernel kernel);
+
+/** \brief A packet tag that caches the hash sequence of the packet's name.
+ *  \sa getHashes
+ */
+class HashSequenceTag : public ndn::Tag
+{
+public:
+  static constexpr int
+  getTypeId() noexcept
+  {
+    return 0x60000001;
+  }
+
+  HashSequenceTag(const Block& nameWire, const HashSequence& hashes)
+    : nameWire(nameWire)
+    , hashes(hashes)
+  {
+  }
+
+public:
+  /** \brief Wire encoding of the name from which #hashes was computed.
+   *
+   *  Holding the Block keeps the underlying buffer alive, so that a different name
+   *  cannot reuse the same wire address while the tag exists.
+   */
+  Block nameWire;
+  HashSequence hashes;
+};
+
+/** \brief Returns the hash values for each prefix of \p interest 's name.
+ *
+ *  The hash sequence covers up to NameTree::getMaxDepth() components. It is computed on first use
+ *  and cached on the packet as a HashSequenceTag, so that subsequent table lookups for the same
+ *  packet (PIT, strategy choice, etc.) do not recompute it. The cache is ignored if the name has
+ *  been changed since.
+ *  \return a reference that is valid until the packet's tags are modified
+ */
+const HashSequence&
+getHashes(const Interest& interest);
+
+/** \brief Returns the hash values for each prefix of \p data 's name.
+ *
+ *  Unlike getHashes(const Interest&), the result is not cached on the packet: a Data is looked
+ *  up only once, and a tag would stay attached to the packet, uncounted, for as long as it is
+ *  kept in the Content Store.
+ */
+HashSequence
+getHashes(const Data& data);
+
 /** \brief A hashtable node.
  *
- *  Zero or more nodes can be added to a hashtable bucket. They are organized as
- *  a doubly linked list through prev and next pointers.
+ *  In HashtableMode::CHAINING, zero or more nodes can be added to a hashtable bucket.
+ *  They are organized as a doubly linked list through prev and next pointers.
+ *  In HashtableMode::OPEN_ADDRESSING, a bucket holds at most one node, and prev and next
+ *  are always nullptr.
  */
 class Node : noncopyable
 {
@@ -72,6 +167,14 @@ public:
    */
   ~Node();
 
+  /** \brief Allocates memory for a Node from a MemoryPool.
+   */
+  static void*
+  operator new(size_t size);
+
+  static void
+  operator delete(void* ptr, size_t size) noexcept;
+
 public:
   const HashValue hash;
   Node* prev;
@@ -102,6 +205,20 @@ foreachNode(N* head, const F& func)
   }
 }
 
+/**
+ * \brief Collision resolution scheme of a Hashtable.
+ */
+enum class HashtableMode {
+  /// Nodes whose hash values map to the same bucket are chained in a doubly linked list.
+  CHAINING,
+  /// Each bucket holds at most one node. Collisions are resolved with Robin Hood linear probing
+  /// over a dense array of per-bucket fingerprints, so that a probe rarely dereferences a node.
+  OPEN_ADDRESSING,
+};
+
+std::ostream&
+operator<<(std::ostream& os, HashtableMode mode);
+
 /**
  * \brief Provides options for Hashtable.
  */
@@ -114,6 +231,20 @@ struct HashtableOptions
   explicit
   HashtableOptions(size_t size = 16);
 
+  /** \brief Collision resolution scheme.
+   *
+   *  HashtableMode::OPEN_ADDRESSING requires `expandLoadFactor < 1` and
+   *  `shrinkLoadFactor < shrinkFactor`, so that the table never fills up.
+   */
+  HashtableMode mode = HashtableMode::CHAINING;
+
+  /** \brief Number of old buckets migrated by each insertion or deletion during a resize.
+   *
+   *  Zero means all nodes are migrated at once, when the resize is triggered. A small value bounds
+   *  the latency of each operation; lookups consult both bucket arrays until migration completes.
+   */
+  size_t resizeStep = 64;
+
   /** \brief Initial number of buckets.
    */
   size_t initialSize;
@@ -144,8 +275,13 @@ struct HashtableOptions
  *
  * The Hashtable contains a number of buckets.
  * Each node is placed into a bucket determined by a hash value computed from its name.
- * Hash collision is resolved through a doubly linked list in each bucket.
+ * Hash collision is resolved either through a doubly linked list in each bucket, or through
+ * open addressing, depending on HashtableOptions::mode.
  * The number of buckets is adjusted according to how many nodes are stored.
+ *
+ * When the number of buckets is adjusted, nodes are migrated from the old bucket array to the
+ * new one incrementally: each insertion or deletion migrates up to HashtableOptions::resizeStep
+ * buckets, and lookups consult both bucket arrays until the migration is complete.
  */
 class Hashtable
 {
@@ -168,11 +304,12 @@ public:
   }
 
   /** \return number of buckets
+   *  \note During an incremental resize, this is the number of buckets in the new bucket array.
    */
   size_t
   getNBuckets() const
   {
-    return m_buckets.size();
+    return m_table.nodes.size();
   }
 
   /** \return bucket index for hash value h
@@ -190,9 +327,35 @@ public:
   getBucket(size_t bucket) const
   {
     BOOST_ASSERT(bucket < this->getNBuckets());
-    return m_buckets[bucket]; // don't use m_bucket.at() for better performance
+    return m_table.nodes[bucket]; // don't use m_table.nodes.at() for better performance
   }
 
+  /** \return whether an incremental resize is in progress
+   */
+  bool
+  isResizing() const
+  {
+    return !m_oldTable.nodes.empty();
+  }
+
+  /** \return number of resize steps executed so far
+   *
+   *  Each step migrates up to HashtableOptions::resizeStep buckets from the old bucket array.
+   */
+  size_t
+  getNResizeSteps() const
+  {
+    return m_nResizeSteps;
+  }
+
+  /** \return node following \p node in enumeration order, or the first node if \p node is nullptr;
+   *          nullptr if there are no more nodes
+   *  \pre node is nullptr or exists in this hashtable
+   *  \note Enumeration order is implementation-defined.
+   */
+  const Node*
+  getNextNode(const Node* node) const;
+
   /** \brief Find node for name.getPrefix(prefixLen).
    *  \pre name.size() > prefixLen
    */
@@ -220,15 +383,84 @@ public:
   erase(Node* node);
 
 private:
+  /** \brief Probe metadata of a bucket in HashtableMode::OPEN_ADDRESSING.
+   */
+  struct Slot
+  {
+    uint32_t fingerprint = 0; ///< digest of the node's hash value
+    uint32_t distance = 0;    ///< 0 if the bucket is empty, otherwise 1 + distance from home bucket
+  };
+
+  /** \brief An array of buckets.
+   *
+   *  In the old bucket array of an open addressing table, a migrated or deleted node leaves
+   *  its Slot in place with a nullptr node, so that probe runs of remaining nodes stay intact.
+   */
+  struct BucketArray
+  {
+    std::vector<Node*> nodes;
+    std::vector<Slot> slots; ///< parallel to nodes, only used in open addressing mode
+
+    size_t
+    computeIndex(HashValue h) const
+    {
+      return h % nodes.size();
+    }
+
+    size_t
+    next(size_t bucket) const
+    {
+      return ++bucket == nodes.size() ? 0 : bucket;
+    }
+  };
+
+  static uint32_t
+  computeFingerprint(HashValue h)
+  {
+    return static_cast<uint32_t>(h ^ (static_cast<uint64_t>(h) >> 32));
+  }
+
   /** \brief Attach node to bucket.
    */
-  void
-  attach(size_t bucket, Node* node);
+  static void
+  attach(BucketArray& table, size_t bucket, Node* node);
 
   /** \brief Detach node from bucket.
    */
-  void
-  detach(size_t bucket, Node* node);
+  static void
+  detach(BucketArray& table, size_t bucket, Node* node);
+
+  /** \brief Find node in an open addressing bucket array.
+   *  \param[in,out] bucket home bucket of \p h; when the node is not found,
+   *                        the bucket at which the probe stopped
+   *  \param[in,out] probe probe metadata at \p bucket
+   */
+  static const Node*
+  findOpen(const BucketArray& table, const Name& name, size_t prefixLen, HashValue h,
+           size_t& bucket, Slot& probe);
+
+  /** \brief Place node into an open addressing bucket array, starting at bucket with given metadata.
+   *
+   *  Nodes that are closer to their home buckets are displaced as needed (Robin Hood hashing).
+   */
+  static void
+  placeOpen(BucketArray& table, size_t bucket, Slot slot, Node* node);
+
+  /** \brief Remove the node in bucket from an open addressing bucket array.
+   *
+   *  Subsequent nodes in the same probe run are shifted backwards to fill the gap.
+   */
+  static void
+  removeOpen(BucketArray& table, size_t bucket);
+
+  /** \brief Determine the bucket that contains node.
+   *  \return whether the bucket is in the old bucket array, and the bucket index
+   */
+  std::pair<bool, size_t>
+  locate(const Node& node) const;
+
+  const Node*
+  findOld(const Name& name, size_t prefixLen, HashValue h) const;
 
   std::pair<const Node*, bool>
   findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert);
@@ -236,11 +468,23 @@ private:
   void
   computeThresholds();
 
+  /** \brief Start migrating nodes into a new bucket array with newNBuckets buckets.
+   *
+   *  A resize that is already in progress is completed first.
+   */
   void
   resize(size_t newNBuckets);
 
+  /** \brief Migrate up to maxBuckets buckets from the old bucket array.
+   */
+  void
+  migrate(size_t maxBuckets);
+
 private:
-  std::vector<Node*> m_buckets;
+  BucketArray m_table;
+  BucketArray m_oldTable; ///< bucket array being migrated from, empty if not resizing
+  size_t m_nMigratedBuckets = 0; ///< buckets in m_oldTable before this index have been migrated
+  size_t m_nResizeSteps = 0;
   Options m_options;
   size_t m_size;
   size_t m_expandThreshold;
@@ -39,6 +39,11 @@ public:
   explicit
   NameTree(size_t nBuckets = 1024);
 
+  /** \brief Construct a name tree whose hashtable uses the specified options.
+   */
+  explicit
+  NameTree(const HashtableOptions& options);
+
 public: // information
   /** \brief Maximum depth of the name tree
    *
@@ -69,6 +74,15 @@ public: // information
     return m_ht.getNBuckets();
   }
 
+  /** \return number of hashtable resize steps executed so far
+   *  \sa Hashtable::getNResizeSteps()
+   */
+  size_t
+  getNResizeSteps() const
+  {
+    return m_ht.getNResizeSteps();
+  }
+
   /** \return name tree entry on which a table entry is attached,
    *          or nullptr if the table entry is detached
    */
@@ -92,6 +106,13 @@ public: // mutation
   Entry&
   lookup(const Name& name, size_t prefixLen);
 
+  /** \brief Equivalent to `lookup(name, prefixLen)`, using precomputed hash values
+   *  \pre `hashes.size() > prefixLen`, and each hash value equals `computeHash(name, i)`
+   *  \sa getHashes
+   */
+  Entry&
+  lookup(const Name& name, size_t prefixLen, const HashSequence& hashes);
+
   /** \brief Equivalent to `lookup(name, name.size())`
    */
   Entry&
@@ -148,6 +169,12 @@ public: // matching
   Entry*
   findExactMatch(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max()) const;
 
+  /** \brief Equivalent to `findExactMatch(name, prefixLen)`, using precomputed hash values
+   *  \pre `hashes.size() > std::min(name.size(), prefixLen, getMaxDepth())`
+   */
+  Entry*
+  findExactMatch(const Name& name, size_t prefixLen, const HashSequence& hashes) const;
+
   /** \brief Longest prefix matching
    *  \return entry whose name is a prefix of \p name and passes \p entrySelector,
    *          where no other entry with a longer name satisfies those requirements;
@@ -157,6 +184,13 @@ public: // matching
   findLongestPrefixMatch(const Name& name,
                          const EntrySelector& entrySelector = AnyEntry()) const;
 
+  /** \brief Equivalent to `findLongestPrefixMatch(name, entrySelector)`, using precomputed hash values
+   *  \pre `hashes.size() > std::min(name.size(), getMaxDepth())`
+   */
+  Entry*
+  findLongestPrefixMatch(const Name& name, const HashSequence& hashes,
+                         const EntrySelector& entrySelector = AnyEntry()) const;
+
   /** \brief Equivalent to `findLongestPrefixMatch(entry.getName(), entrySelector)`
    *  \note This overload is more efficient than
    *        `findLongestPrefixMatch(const Name&, const EntrySelector&)` in common cases.
@@ -213,6 +247,13 @@ public: // matching
   findAllMatches(const Name& name,
                  const EntrySelector& entrySelector = AnyEntry()) const;
 
+  /** \brief Equivalent to `findAllMatches(name, entrySelector)`, using precomputed hash values
+   *  \pre `hashes.size() > std::min(name.size(), getMaxDepth())`
+   */
+  Range
+  findAllMatches(const Name& name, const HashSequence& hashes,
+                 const EntrySelector& entrySelector = AnyEntry()) const;
+
 public: // enumeration
   using const_iterator = Iterator;
 
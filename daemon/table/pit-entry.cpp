@@ -91,8 +91,7 @@ Entry::insertOrUpdateInRecord(Face& face, const Interest& interest)
 
   auto it = findInRecord(face);
   if (it == m_inRecords.end()) {
-    m_inRecords.emplace_front(face);
-    it = m_inRecords.begin();
+    it = m_inRecords.emplace(m_inRecords.begin(), face);
   }
 
   it->update(interest);
@@ -113,8 +112,7 @@ Entry::insertOrUpdateOutRecord(Face& face, const Interest& interest)
 
   auto it = findOutRecord(face);
   if (it == m_outRecords.end()) {
-    m_outRecords.emplace_front(face);
-    it = m_outRecords.begin();
+    it = m_outRecords.emplace(m_outRecords.begin(), face);
   }
 
   it->update(interest);
@@ -27,10 +27,9 @@
 #define NFD_DAEMON_TABLE_PIT_ENTRY_HPP
 
 #include "strategy-info-host.hpp"
+#include "common/timer-wheel.hpp"
 
-#include <ndn-cxx/util/scheduler.hpp>
-
-#include <list>
+#include <boost/container/small_vector.hpp>
 
 namespace nfd {
 
@@ -55,14 +54,14 @@ class FaceRecord : public StrategyInfoHost
 public:
   explicit
   FaceRecord(Face& face)
-    : m_face(face)
+    : m_face(&face)
   {
   }
 
   Face&
   getFace() const noexcept
   {
-    return m_face;
+    return *m_face;
   }
 
   Interest::Nonce
@@ -94,7 +93,7 @@ public:
   update(const Interest& interest);
 
 private:
-  Face& m_face;
+  Face* m_face; // pointer rather than reference, so that records can be moved within a collection
   Interest::Nonce m_lastNonce{0, 0, 0, 0};
   time::steady_clock::time_point m_lastRenewed = time::steady_clock::time_point::min();
   time::steady_clock::time_point m_expiry = time::steady_clock::time_point::min();
@@ -174,13 +173,21 @@ private:
 
 /**
  * \brief An unordered collection of in-records.
+ *
+ * Most PIT entries have one or two in-records, which are stored inline within the entry.
+ * Inserting or deleting an in-record invalidates iterators, pointers, and references
+ * to other in-records of the same entry.
  */
-using InRecordCollection = std::list<InRecord>;
+using InRecordCollection = boost::container::small_vector<InRecord, 2>;
 
 /**
  * \brief An unordered collection of out-records.
+ *
+ * Most PIT entries have one or two out-records, which are stored inline within the entry.
+ * Inserting or deleting an out-record invalidates iterators, pointers, and references
+ * to other out-records of the same entry.
  */
-using OutRecordCollection = std::list<OutRecord>;
+using OutRecordCollection = boost::container::small_vector<OutRecord, 2>;
 
 /**
  * \brief Represents an entry in the %Interest table (PIT).
@@ -374,7 +381,7 @@ public:
    *
    *  This timer is used in forwarding pipelines to delete the entry
    */
-  ndn::scheduler::EventId expiryTimer;
+  TimerWheel::Timer expiryTimer;
 
   /** \brief Indicates whether this PIT entry is satisfied.
    */
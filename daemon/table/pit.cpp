@@ -56,12 +56,13 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
   nteDepth = std::min(nteDepth, NameTree::getMaxDepth());
 
   // ensure NameTree entry exists
+  const auto& hashes = name_tree::getHashes(interest);
   name_tree::Entry* nte = nullptr;
   if (allowInsert) {
-    nte = &m_nameTree.lookup(name, nteDepth);
+    nte = &m_nameTree.lookup(name, nteDepth, hashes);
   }
   else {
-    nte = m_nameTree.findExactMatch(name, nteDepth);
+    nte = m_nameTree.findExactMatch(name, nteDepth, hashes);
     if (nte == nullptr) {
       return {nullptr, true};
     }
@@ -83,6 +84,8 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
     return {nullptr, true};
   }
 
+  // not allocated from a MemoryPool: the control block is freed by the last weak_ptr, which
+  // may be dropped on another thread (e.g., by SelfLearningStrategy on the RIB thread)
   auto entry = make_shared<Entry>(interest);
   nte->insertPitEntry(entry);
   ++m_nItems;
@@ -98,7 +101,8 @@ nteHasPitEntries(const name_tree::Entry& nte)
 DataMatchResult
 Pit::findAllDataMatches(const Data& data) const
 {
-  auto&& ntMatches = m_nameTree.findAllMatches(data.getName(), &nteHasPitEntries);
+  auto&& ntMatches = m_nameTree.findAllMatches(data.getName(), name_tree::getHashes(data),
+                                               &nteHasPitEntries);
 
   DataMatchResult matches;
   for (const auto& nte : ntMatches) {
@@ -60,6 +60,7 @@ StrategyChoice::setDefaultStrategy(const Name& strategyName)
   name_tree::Entry& nte = m_nameTree.lookup(Name());
   nte.setStrategyChoiceEntry(std::move(entry));
   ++m_nItems;
+  ++m_generation;
 }
 
 StrategyChoice::InsertResult
@@ -106,6 +107,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 
   this->changeStrategy(*entry, *oldStrategy, *strategy);
   entry->setStrategy(std::move(strategy));
+  ++m_generation;
   return InsertResult::OK;
 }
 
@@ -155,6 +157,7 @@ StrategyChoice::erase(const Name& prefix)
   nte->setStrategyChoiceEntry(nullptr);
   m_nameTree.eraseIfEmpty(nte);
   --m_nItems;
+  ++m_generation;
 }
 
 std::pair<bool, Name>
@@ -182,22 +185,55 @@ StrategyChoice::findEffectiveStrategyImpl(const K& key) const
   return nte->getStrategyChoiceEntry()->getStrategy();
 }
 
+template<typename EntryT>
+Strategy&
+StrategyChoice::findEffectiveStrategyCached(const EntryT& tableEntry) const
+{
+  const name_tree::Entry* nte = m_nameTree.getEntry(tableEntry);
+  BOOST_ASSERT(nte != nullptr);
+
+  if (nte->getName().size() < tableEntry.getName().size()) {
+    // PIT entry name ends with an implicit digest or exceeds the depth limit, see
+    // Fib::findLongestPrefixMatchCached()
+    return this->findEffectiveStrategyImpl(tableEntry);
+  }
+
+  auto& cache = nte->getStrategyCache();
+  if (Strategy* strategy = cache.get(m_generation); strategy != nullptr) {
+    return *strategy;
+  }
+
+  Strategy& strategy = this->findEffectiveStrategyImpl(tableEntry);
+  cache.set(&strategy, m_generation);
+  return strategy;
+}
+
 Strategy&
 StrategyChoice::findEffectiveStrategy(const Name& prefix) const
 {
   return this->findEffectiveStrategyImpl(prefix);
 }
 
+Strategy&
+StrategyChoice::findEffectiveStrategy(const Interest& interest) const
+{
+  const name_tree::Entry* nte = m_nameTree.findLongestPrefixMatch(interest.getName(),
+                                                                  name_tree::getHashes(interest),
+                                                                  &nteHasStrategyChoiceEntry);
+  BOOST_ASSERT(nte != nullptr);
+  return nte->getStrategyChoiceEntry()->getStrategy();
+}
+
 Strategy&
 StrategyChoice::findEffectiveStrategy(const pit::Entry& pitEntry) const
 {
-  return this->findEffectiveStrategyImpl(pitEntry);
+  return this->findEffectiveStrategyCached(pitEntry);
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const measurements::Entry& measurementsEntry) const
 {
-  return this->findEffectiveStrategyImpl(measurementsEntry);
+  return this->findEffectiveStrategyCached(measurementsEntry);
 }
 
 static inline void
@@ -137,6 +137,15 @@ public: // effective strategy
   fw::Strategy&
   findEffectiveStrategy(const Name& prefix) const;
 
+  /** \brief Get effective strategy for \p interest
+   *
+   *  This is equivalent to `findEffectiveStrategy(interest.getName())`, but reuses
+   *  the hash values cached on \p interest.
+   *  \sa name_tree::getHashes
+   */
+  fw::Strategy&
+  findEffectiveStrategy(const Interest& interest) const;
+
   /** \brief Get effective strategy for \p pitEntry
    *
    *  This is equivalent to `findEffectiveStrategy(pitEntry.getName())`
@@ -187,6 +196,13 @@ private:
   fw::Strategy&
   findEffectiveStrategyImpl(const K& key) const;
 
+  /** \brief Effective strategy for a table entry, memoized on its name tree entry
+   *  \tparam EntryT \c pit::Entry or \c measurements::Entry
+   */
+  template<typename EntryT>
+  fw::Strategy&
+  findEffectiveStrategyCached(const EntryT& tableEntry) const;
+
   Range
   getRange() const;
 
@@ -194,6 +210,8 @@ private:
   Forwarder& m_forwarder;
   NameTree& m_nameTree;
   size_t m_nItems = 0;
+  /// incremented whenever an entry or its strategy changes, invalidating cached lookups
+  uint64_t m_generation = 1;
 };
 
 std::ostream&
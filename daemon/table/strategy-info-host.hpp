@@ -28,11 +28,17 @@
 
 #include "fw/strategy-info.hpp"
 
-#include <unordered_map>
+#include <algorithm>
+
+#include <boost/container/small_vector.hpp>
 
 namespace nfd {
 
 /** \brief Base class for an entity onto which StrategyInfo items may be placed
+ *
+ *  Items are stored as (type ID, item) pairs in a small vector. A host rarely carries more than
+ *  a couple of items, so finding one is a short linear scan, and hosts with up to two items do
+ *  not allocate any container storage.
  */
 class StrategyInfoHost
 {
@@ -47,7 +53,7 @@ public:
   {
     static_assert(std::is_base_of_v<fw::StrategyInfo, T>);
 
-    auto it = m_items.find(T::getTypeId());
+    auto it = find(T::getTypeId());
     if (it == m_items.end()) {
       return nullptr;
     }
@@ -65,12 +71,12 @@ public:
   {
     static_assert(std::is_base_of_v<fw::StrategyInfo, T>);
 
-    auto& item = m_items[T::getTypeId()];
-    bool isNew = item == nullptr;
-    if (isNew) {
-      item = make_unique<T>(std::forward<A>(args)...);
+    auto it = find(T::getTypeId());
+    if (it != m_items.end()) {
+      return {static_cast<T*>(it->second.get()), false};
     }
-    return {static_cast<T*>(item.get()), isNew};
+    auto& item = m_items.emplace_back(T::getTypeId(), make_unique<T>(std::forward<A>(args)...));
+    return {static_cast<T*>(item.second.get()), true};
   }
 
   /** \brief Erase a StrategyInfo item
@@ -83,7 +89,16 @@ public:
   {
     static_assert(std::is_base_of_v<fw::StrategyInfo, T>);
 
-    return m_items.erase(T::getTypeId());
+    auto it = find(T::getTypeId());
+    if (it == m_items.end()) {
+      return 0;
+    }
+    // order does not matter, so move the last item into the hole instead of shifting
+    if (auto last = std::prev(m_items.end()); it != last) {
+      *it = std::move(*last);
+    }
+    m_items.pop_back();
+    return 1;
   }
 
   /** \brief Clear all StrategyInfo items
@@ -95,7 +110,25 @@ public:
   }
 
 private:
-  std::unordered_map<int, unique_ptr<fw::StrategyInfo>> m_items;
+  using Item = std::pair<int, unique_ptr<fw::StrategyInfo>>;
+  using Container = boost::container::small_vector<Item, 2>;
+
+  Container::const_iterator
+  find(int typeId) const
+  {
+    return std::find_if(m_items.begin(), m_items.end(),
+                        [typeId] (const Item& item) { return item.first == typeId; });
+  }
+
+  Container::iterator
+  find(int typeId)
+  {
+    return std::find_if(m_items.begin(), m_items.end(),
+                        [typeId] (const Item& item) { return item.first == typeId; });
+  }
+
+private:
+  Container m_items;
 };
 
 } // namespace nfd
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/memory-pool.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <algorithm>
+#include <list>
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(TestMemoryPool)
+
+BOOST_AUTO_TEST_CASE(AllocateDeallocate)
+{
+  MemoryPool pool("test", 4);
+  BOOST_CHECK_EQUAL(pool.getName(), "test");
+  BOOST_CHECK_EQUAL(pool.getBlockSize(), 0);
+  BOOST_CHECK_EQUAL(pool.getNInUse(), 0);
+  BOOST_CHECK_EQUAL(pool.getCapacity(), 0);
+
+  const auto& pools = MemoryPool::getPools();
+  BOOST_CHECK(std::find(pools.begin(), pools.end(), &pool) != pools.end());
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 5; ++i) {
+    blocks.push_back(pool.allocate(24));
+  }
+  BOOST_CHECK_GE(pool.getBlockSize(), 24);
+  BOOST_CHECK_EQUAL(pool.getBlockSize() % alignof(std::max_align_t), 0);
+  BOOST_CHECK_EQUAL(pool.getNInUse(), 5);
+  BOOST_CHECK_EQUAL(pool.getCapacity(), 8);
+  std::sort(blocks.begin(), blocks.end());
+  BOOST_CHECK(std::adjacent_find(blocks.begin(), blocks.end()) == blocks.end());
+
+  // a freed block is reused
+  void* last = blocks.back();
+  pool.deallocate(last, 24);
+  BOOST_CHECK_EQUAL(pool.getNInUse(), 4);
+  BOOST_CHECK_EQUAL(pool.allocate(24), last);
+  BOOST_CHECK_EQUAL(pool.getNInUse(), 5);
+
+  // larger blocks are not taken from the pool
+  void* large = pool.allocate(pool.getBlockSize() + 1);
+  BOOST_CHECK_EQUAL(pool.getNInUse(), 5);
+  pool.deallocate(large, pool.getBlockSize() + 1);
+
+  for (void* block : blocks) {
+    pool.deallocate(block, 24);
+  }
+  BOOST_CHECK_EQUAL(pool.getNInUse(), 0);
+  BOOST_CHECK_EQUAL(pool.getCapacity(), 8); // memory is retained
+}
+
+struct TestPoolTag
+{
+  static constexpr const char* POOL_NAME = "test-pool-allocator";
+};
+
+BOOST_AUTO_TEST_CASE(Allocator)
+{
+  MemoryPool& pool = getMemoryPool<TestPoolTag>();
+  BOOST_CHECK_EQUAL(&getMemoryPool<TestPoolTag>(), &pool);
+  BOOST_CHECK_EQUAL(pool.getName(), "test-pool-allocator");
+  size_t nInUse = pool.getNInUse();
+
+  {
+    std::list<int, PoolAllocator<int, TestPoolTag>> list{1, 2, 3};
+    BOOST_CHECK_EQUAL(pool.getNInUse(), nInUse + 3);
+    list.pop_front();
+    BOOST_CHECK_EQUAL(pool.getNInUse(), nInUse + 2);
+  }
+  BOOST_CHECK_EQUAL(pool.getNInUse(), nInUse);
+}
+
+struct TestSharedPoolTag
+{
+  static constexpr const char* POOL_NAME = "test-pool-allocate-shared";
+};
+
+BOOST_AUTO_TEST_CASE(AllocateShared)
+{
+  MemoryPool& pool = getMemoryPool<TestSharedPoolTag>();
+  size_t nInUse = pool.getNInUse();
+
+  auto ptr = std::allocate_shared<std::string>(PoolAllocator<std::string, TestSharedPoolTag>(), "x");
+  BOOST_CHECK_EQUAL(*ptr, "x");
+  BOOST_CHECK_EQUAL(pool.getNInUse(), nInUse + 1); // object and control block share one block
+
+  ptr.reset();
+  BOOST_CHECK_EQUAL(pool.getNInUse(), nInUse);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestMemoryPool
+
+} // namespace nfd::tests
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/spsc-queue.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <thread>
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(TestSpscQueue)
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  SpscQueue<int> q1(1);
+  BOOST_CHECK_EQUAL(q1.capacity(), 1);
+  SpscQueue<int> q5(5);
+  BOOST_CHECK_EQUAL(q5.capacity(), 8);
+  SpscQueue<int> q16(16);
+  BOOST_CHECK_EQUAL(q16.capacity(), 16);
+}
+
+BOOST_AUTO_TEST_CASE(PushPop)
+{
+  SpscQueue<std::string> q(4);
+  BOOST_CHECK(q.empty());
+  BOOST_CHECK(!q.tryPop());
+
+  for (int round = 0; round < 3; ++round) {
+    // wrap around the ring several times
+    for (int i = 0; i < 4; ++i) {
+      BOOST_CHECK(q.tryPush(std::to_string(i)));
+    }
+    BOOST_CHECK_EQUAL(q.size(), 4);
+
+    std::string rejected("4");
+    BOOST_CHECK(!q.tryPush(std::move(rejected)));
+    BOOST_CHECK_EQUAL(rejected, "4"); // not moved from
+
+    for (int i = 0; i < 3; ++i) {
+      auto value = q.tryPop();
+      BOOST_REQUIRE(value);
+      BOOST_CHECK_EQUAL(*value, std::to_string(i));
+    }
+    BOOST_CHECK(q.tryPush(std::move(rejected)));
+    BOOST_CHECK_EQUAL(*q.tryPop(), "3");
+    BOOST_CHECK_EQUAL(*q.tryPop(), "4");
+    BOOST_CHECK(q.empty());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Destructor)
+{
+  auto obj = make_shared<int>(1);
+  {
+    SpscQueue<shared_ptr<int>> q(4);
+    q.tryPush(obj);
+    q.tryPush(obj);
+    BOOST_CHECK_EQUAL(obj.use_count(), 3);
+  }
+  BOOST_CHECK_EQUAL(obj.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(TwoThreads)
+{
+  constexpr uint64_t N_ITEMS = 200000;
+  SpscQueue<uint64_t> q(64);
+
+  std::thread producer([&] {
+    for (uint64_t i = 0; i < N_ITEMS; ++i) {
+      while (!q.tryPush(uint64_t(i))) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  uint64_t expected = 0;
+  bool isInOrder = true;
+  while (expected < N_ITEMS) {
+    auto value = q.tryPop();
+    if (!value) {
+      std::this_thread::yield();
+      continue;
+    }
+    isInOrder = isInOrder && *value == expected;
+    ++expected;
+  }
+  producer.join();
+
+  BOOST_CHECK(isInOrder);
+  BOOST_CHECK(q.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSpscQueue
+
+} // namespace nfd::tests
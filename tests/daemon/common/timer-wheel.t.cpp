@@ -0,0 +1,192 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/timer-wheel.hpp"
+#include "common/global.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+namespace nfd::tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestTimerWheel, GlobalIoTimeFixture)
+
+BOOST_AUTO_TEST_CASE(Expire)
+{
+  TimerWheel& wheel = getTimerWheel();
+  std::vector<int> fired;
+  TimerWheel::Timer t1([&] { fired.push_back(1); });
+  TimerWheel::Timer t2([&] { fired.push_back(2); });
+  TimerWheel::Timer t3([&] { fired.push_back(3); });
+
+  // one timer on each of the three lowest levels
+  wheel.schedule(t1, 70_s);
+  wheel.schedule(t2, 10_ms);
+  wheel.schedule(t3, 300_ms);
+  BOOST_CHECK_EQUAL(wheel.size(), 3);
+  BOOST_CHECK(t1 && t2 && t3);
+
+  advanceClocks(1_ms, 9);
+  BOOST_CHECK(fired.empty());
+  advanceClocks(1_ms);
+  BOOST_CHECK(fired == std::vector<int>({2}));
+  BOOST_CHECK(!t2);
+
+  advanceClocks(1_ms, 289);
+  BOOST_CHECK_EQUAL(fired.size(), 1);
+  advanceClocks(1_ms);
+  BOOST_CHECK(fired == std::vector<int>({2, 3}));
+
+  advanceClocks(100_ms, 696);
+  BOOST_CHECK_EQUAL(fired.size(), 2);
+  advanceClocks(100_ms, 4);
+  BOOST_CHECK(fired == std::vector<int>({2, 3, 1}));
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ZeroDelay)
+{
+  TimerWheel& wheel = getTimerWheel();
+  int nFired = 0;
+  TimerWheel::Timer timer([&] { ++nFired; });
+
+  wheel.schedule(timer, 0_ms);
+  BOOST_CHECK_EQUAL(nFired, 0);
+  pollIo();
+  BOOST_CHECK_EQUAL(nFired, 1);
+
+  // sub-millisecond delays are rounded up, never down
+  wheel.schedule(timer, 100_us);
+  pollIo();
+  BOOST_CHECK_EQUAL(nFired, 1);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nFired, 2);
+}
+
+BOOST_AUTO_TEST_CASE(CancelRearm)
+{
+  TimerWheel& wheel = getTimerWheel();
+  int nFired = 0;
+  TimerWheel::Timer timer([&] { ++nFired; });
+
+  wheel.schedule(timer, 50_ms);
+  advanceClocks(10_ms, 2);
+  timer.cancel();
+  BOOST_CHECK(!timer);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  advanceClocks(10_ms, 10);
+  BOOST_CHECK_EQUAL(nFired, 0);
+
+  // re-arming replaces the previous expiration, including with an earlier one
+  wheel.schedule(timer, 500_ms);
+  advanceClocks(10_ms, 10);
+  wheel.schedule(timer, 20_ms);
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+  advanceClocks(10_ms, 2);
+  BOOST_CHECK_EQUAL(nFired, 1);
+  advanceClocks(100_ms, 10);
+  BOOST_CHECK_EQUAL(nFired, 1);
+
+  {
+    TimerWheel::Timer scoped([&] { ++nFired; });
+    wheel.schedule(scoped, 10_ms);
+    BOOST_CHECK_EQUAL(wheel.size(), 1);
+  }
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  advanceClocks(10_ms, 2);
+  BOOST_CHECK_EQUAL(nFired, 1);
+}
+
+BOOST_AUTO_TEST_CASE(Reentrant)
+{
+  TimerWheel& wheel = getTimerWheel();
+  std::vector<int> fired;
+  auto t2 = make_unique<TimerWheel::Timer>([&] { fired.push_back(2); });
+  auto t3 = make_unique<TimerWheel::Timer>();
+  TimerWheel::Timer t1([&] {
+    fired.push_back(1);
+    t2->cancel();
+    wheel.schedule(*t3, 5_ms);
+  });
+  t3->setCallback([&] {
+    fired.push_back(3);
+    t3.reset(); // destroy the timer from within its own callback
+  });
+
+  // t1 and t2 expire on the same tick
+  wheel.schedule(t1, 10_ms);
+  wheel.schedule(*t2, 10_ms);
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK(fired == std::vector<int>({1}));
+  advanceClocks(1_ms, 5);
+  BOOST_CHECK(fired == std::vector<int>({1, 3}));
+  BOOST_CHECK(t3 == nullptr);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(FarFuture)
+{
+  TimerWheel& wheel = getTimerWheel();
+  std::vector<int> fired;
+  TimerWheel::Timer t1([&] { fired.push_back(1); });
+  TimerWheel::Timer t2([&] { fired.push_back(2); });
+  TimerWheel::Timer t3([&] { fired.push_back(3); });
+
+  // t1 and t2 are beyond the span of the top level; t2 stays there after the first revolution
+  wheel.schedule(t1, time::hours(60 * 24));
+  wheel.schedule(t2, time::hours(120 * 24));
+  wheel.schedule(t3, 1_s);
+  BOOST_CHECK_EQUAL(wheel.size(), 3);
+
+  advanceClocks(1_s);
+  BOOST_CHECK(fired == std::vector<int>({3}));
+
+  advanceClocks(1_h, 60 * 24 - 1);
+  BOOST_CHECK_EQUAL(fired.size(), 1);
+  advanceClocks(1_h);
+  BOOST_CHECK(fired == std::vector<int>({3, 1}));
+  BOOST_CHECK(t2);
+
+  advanceClocks(1_h, 60 * 24 - 1);
+  BOOST_CHECK_EQUAL(fired.size(), 2);
+  advanceClocks(1_h);
+  BOOST_CHECK(fired == std::vector<int>({3, 1, 2}));
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(OutliveWheel)
+{
+  TimerWheel::Timer timer([] {});
+  auto wheel = make_unique<TimerWheel>(getScheduler());
+  wheel->schedule(timer, 1_s);
+  BOOST_CHECK(timer);
+
+  wheel.reset();
+  BOOST_CHECK(!timer);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTimerWheel
+
+} // namespace nfd::tests
@@ -173,6 +173,72 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendQueueLength, T, DatagramTransportFixtures,
   BOOST_CHECK_EQUAL(this->transport->getSendQueueLength(), 0);
 }
 
+#ifdef __linux__
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendBatched, T, DatagramTransportFixtures, T)
+{
+  this->batchSize = 8;
+  TRANSPORT_TEST_INIT();
+  BOOST_CHECK_EQUAL(this->transport->getBatchSize(), 8);
+
+  auto block1 = ndn::encoding::makeStringBlock(300, "hello");
+  auto block2 = ndn::encoding::makeStringBlock(301, "world!");
+  this->transport->send(block1);
+  this->transport->send(block2);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutPackets, 2);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutBytes, block1.size() + block2.size());
+
+  std::vector<uint8_t> readBuf1(block1.size());
+  this->remoteRead(readBuf1);
+  std::vector<uint8_t> readBuf2(block2.size());
+  this->remoteRead(readBuf2);
+
+  BOOST_TEST(readBuf1 == block1, boost::test_tools::per_element());
+  BOOST_TEST(readBuf2 == block2, boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(this->transport->getBatchCounters().nTxBatches, 1);
+  BOOST_CHECK_EQUAL(this->transport->getBatchCounters().nTxDatagrams, 2);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveBatched, T, DatagramTransportFixtures, T)
+{
+  this->batchSize = 8;
+  TRANSPORT_TEST_INIT();
+
+  auto pkt1 = ndn::encoding::makeStringBlock(300, "hello");
+  ndn::Buffer buf1(pkt1.begin(), pkt1.end());
+  this->remoteWrite(buf1);
+  auto pkt2 = ndn::encoding::makeStringBlock(301, "world!");
+  ndn::Buffer buf2(pkt2.begin(), pkt2.end());
+  this->remoteWrite(buf2);
+
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInPackets, 2);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInBytes, pkt1.size() + pkt2.size());
+  BOOST_REQUIRE_EQUAL(this->receivedPackets->size(), 2);
+  BOOST_CHECK(this->receivedPackets->at(0).packet == pkt1);
+  BOOST_CHECK(this->receivedPackets->at(1).packet == pkt2);
+
+  const auto& counters = this->transport->getBatchCounters();
+  BOOST_CHECK_EQUAL(counters.nRxDatagrams, 2);
+  BOOST_CHECK_GE(counters.nRxBatches, 1);
+  BOOST_CHECK_LE(counters.nRxBatches, 2);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+#endif // __linux__
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(BatchingDisabled, T, DatagramTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+  BOOST_CHECK_EQUAL(this->transport->getBatchSize(), 1);
+
+  auto block1 = ndn::encoding::makeStringBlock(300, "hello");
+  this->transport->send(block1);
+  std::vector<uint8_t> readBuf(block1.size());
+  this->remoteRead(readBuf);
+
+  BOOST_CHECK_EQUAL(this->transport->getBatchCounters().nTxBatches, 0);
+  BOOST_CHECK_EQUAL(this->transport->getBatchCounters().nTxDatagrams, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestDatagramTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
@@ -72,6 +72,18 @@ public:
     m_sendQueueLength = sendQueueLength;
   }
 
+  time::nanoseconds
+  getSendQueueSojournTime() override
+  {
+    return m_sendQueueSojournTime;
+  }
+
+  void
+  setSendQueueSojournTime(time::nanoseconds sojournTime)
+  {
+    m_sendQueueSojournTime = sojournTime;
+  }
+
   void
   receivePacket(const Block& block)
   {
@@ -104,6 +116,7 @@ public:
 
 private:
   ssize_t m_sendQueueLength = 0;
+  time::nanoseconds m_sendQueueSojournTime{face::QUEUE_UNSUPPORTED};
 };
 
 using DummyTransport = DummyTransportBase<true>;
@@ -317,6 +317,44 @@ BOOST_AUTO_TEST_CASE(Blacklist)
                            }));
 }
 
+BOOST_AUTO_TEST_CASE(PacketRing)
+{
+  SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
+
+  std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        packet_ring
+        {
+          whitelist
+          {
+            ifname %ifname
+          }
+        }
+      }
+    }
+  )CONFIG";
+  auto ifname = netifs.front()->getName();
+  boost::replace_first(CONFIG, "%ifname", ifname);
+
+  parseConfig(CONFIG, true);
+  parseConfig(CONFIG, false);
+
+  auto etherMcastFaces = this->listEtherMcastFaces();
+  BOOST_CHECK_EQUAL(etherMcastFaces.size(), netifs.size());
+  for (const auto* face : etherMcastFaces) {
+    auto transport = dynamic_cast<const face::EthernetTransport*>(face->getTransport());
+    BOOST_REQUIRE(transport != nullptr);
+    // the packet ring may be unavailable even on the whitelisted netif, in which case
+    // the transport falls back to libpcap, but it must never be used on other netifs
+    if (face->getLocalUri() != FaceUri::fromDev(ifname)) {
+      BOOST_CHECK_EQUAL(transport->usesPacketRing(), false);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(Omitted)
 {
   const std::string CONFIG = R"CONFIG(
@@ -425,6 +463,25 @@ BOOST_AUTO_TEST_CASE(BadMcastGroup)
   BOOST_CHECK_THROW(parseConfig(CONFIG2, false), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(BadPacketRing)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      ether
+      {
+        packet_ring
+        {
+          hello
+        }
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE(UnknownOption)
 {
   const std::string CONFIG = R"CONFIG(
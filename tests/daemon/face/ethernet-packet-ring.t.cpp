@@ -0,0 +1,229 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/ethernet-packet-ring.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <linux/filter.h>
+#include <linux/if_packet.h>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+namespace nfd::tests {
+
+using face::PacketRing;
+
+/**
+ * \brief Fixture providing a veth pair, and a raw socket that sends frames into its second end.
+ *
+ * Creating the pair requires superuser privileges and the `ip` command of iproute2. If either
+ * is missing, `isReady` is false.
+ */
+class PacketRingFixture
+{
+protected:
+  PacketRingFixture()
+  {
+    if (::geteuid() != 0) {
+      return;
+    }
+
+    // remove the leftovers of an aborted run, if any
+    runIp("link del " + RX_IFNAME);
+    if (!runIp("link add " + RX_IFNAME + " type veth peer name " + TX_IFNAME)) {
+      return;
+    }
+    m_hasVeth = true;
+    if (!runIp("link set " + RX_IFNAME + " up") || !runIp("link set " + TX_IFNAME + " up")) {
+      return;
+    }
+
+    m_txIfIndex = ::if_nametoindex(TX_IFNAME.data());
+    m_txFd = ::socket(AF_PACKET, SOCK_RAW, 0);
+    isReady = m_txIfIndex != 0 && m_txFd >= 0;
+  }
+
+  ~PacketRingFixture()
+  {
+    if (m_txFd >= 0) {
+      ::close(m_txFd);
+    }
+    if (m_hasVeth) {
+      runIp("link del " + RX_IFNAME);
+    }
+  }
+
+  static bool
+  runIp(const std::string& args)
+  {
+    return std::system(("ip " + args + " >/dev/null 2>&1").data()) == 0;
+  }
+
+  /**
+   * \brief Sends a broadcast NDN frame whose payload starts with \p marker.
+   * \param vlanId if not zero, the frame carries an 802.1Q tag with this VLAN ID
+   */
+  void
+  sendFrame(uint8_t marker, uint16_t vlanId = 0)
+  {
+    std::vector<uint8_t> frame(ethernet::ADDR_LEN, 0xff);
+    frame.insert(frame.end(), {0x02, 0x00, 0x00, 0x00, 0x00, 0x01});
+    auto appendUint16 = [&frame] (uint16_t value) {
+      frame.push_back(static_cast<uint8_t>(value >> 8));
+      frame.push_back(static_cast<uint8_t>(value));
+    };
+    if (vlanId != 0) {
+      appendUint16(0x8100);
+      appendUint16(vlanId);
+    }
+    appendUint16(ethernet::ETHERTYPE_NDN);
+    frame.push_back(marker);
+    frame.resize(frame.size() + ethernet::MIN_DATA_LEN - 1);
+
+    sockaddr_ll sll{};
+    sll.sll_family = AF_PACKET;
+    sll.sll_ifindex = m_txIfIndex;
+    sll.sll_halen = ethernet::ADDR_LEN;
+    std::fill_n(sll.sll_addr, ethernet::ADDR_LEN, 0xff);
+    auto ret = ::sendto(m_txFd, frame.data(), frame.size(), 0,
+                        reinterpret_cast<sockaddr*>(&sll), sizeof(sll));
+    BOOST_REQUIRE_EQUAL(ret, static_cast<ssize_t>(frame.size()));
+  }
+
+  /**
+   * \brief Reads frames from \p ring into `received` until \p isDone returns true.
+   * \return false if this did not happen within two seconds
+   */
+  template<typename Predicate>
+  bool
+  readUntil(PacketRing& ring, const Predicate& isDone)
+  {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!isDone()) {
+      auto [pkt, readErr] = ring.readNextPacket();
+      if (!pkt.empty()) {
+        received.emplace_back(pkt.begin(), pkt.end());
+        continue;
+      }
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+  }
+
+protected:
+  static inline const std::string RX_IFNAME = "nfdtest-ring0";
+  static inline const std::string TX_IFNAME = "nfdtest-ring1";
+
+  bool isReady = false;
+  std::vector<std::vector<uint8_t>> received;
+
+private:
+  bool m_hasVeth = false;
+  int m_txIfIndex = 0;
+  int m_txFd = -1;
+};
+
+#define SKIP_IF_NO_VETH() \
+  do { \
+    if (!this->isReady) { \
+      BOOST_WARN_MESSAGE(false, "skipping assertions that require a veth pair " \
+                                "(superuser privileges and iproute2)"); \
+      return; \
+    } \
+  } while (false)
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestPacketRing, PacketRingFixture)
+
+BOOST_AUTO_TEST_CASE(Receive)
+{
+  SKIP_IF_NO_VETH();
+
+  PacketRing ring(RX_IFNAME);
+  ring.activate();
+  BOOST_CHECK_EQUAL(ring.getNRejected(), 0);
+
+  sendFrame(1);
+  sendFrame(2);
+  BOOST_REQUIRE(readUntil(ring, [this] { return received.size() == 2; }));
+  BOOST_CHECK_EQUAL(received[0].size(), ethernet::HDR_LEN + ethernet::MIN_DATA_LEN);
+  BOOST_CHECK_EQUAL(received[0][ethernet::HDR_LEN], 1);
+  BOOST_CHECK_EQUAL(received[1][ethernet::HDR_LEN], 2);
+  BOOST_CHECK_EQUAL(ring.getNRejected(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RejectVlanTagged)
+{
+  SKIP_IF_NO_VETH();
+
+  PacketRing ring(RX_IFNAME);
+  ring.activate();
+  // the kernel strips the tag before the filter runs, so the filter alone does not reject the frame
+  ring.setPacketFilter("not vlan");
+
+  sendFrame(1, 100);
+  sendFrame(2);
+  BOOST_REQUIRE(readUntil(ring, [&] { return received.size() == 1 && ring.getNRejected() == 1; }));
+  BOOST_CHECK_EQUAL(received[0][ethernet::HDR_LEN], 2);
+}
+
+BOOST_AUTO_TEST_CASE(RejectTruncated)
+{
+  SKIP_IF_NO_VETH();
+
+  PacketRing ring(RX_IFNAME);
+  ring.activate();
+
+  // a filter that accepts only the first 20 bytes of each frame
+  sock_filter insn = BPF_STMT(BPF_RET | BPF_K, 20);
+  sock_fprog prog{1, &insn};
+  int fd = ring.getFd();
+  BOOST_REQUIRE_EQUAL(::setsockopt(fd, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof(prog)), 0);
+
+  sendFrame(1);
+  BOOST_REQUIRE(readUntil(ring, [&] { return ring.getNRejected() == 1; }));
+  BOOST_CHECK(received.empty());
+
+  BOOST_REQUIRE_EQUAL(::setsockopt(fd, SOL_SOCKET, SO_DETACH_FILTER, nullptr, 0), 0);
+  ::close(fd);
+
+  sendFrame(2);
+  BOOST_REQUIRE(readUntil(ring, [this] { return received.size() == 1; }));
+  BOOST_CHECK_EQUAL(received[0][ethernet::HDR_LEN], 2);
+  BOOST_CHECK_EQUAL(ring.getNRejected(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPacketRing
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace nfd::tests
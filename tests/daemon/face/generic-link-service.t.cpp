@@ -107,6 +107,7 @@ BOOST_AUTO_TEST_CASE(SendInterest)
   face->sendInterest(*interest1);
 
   BOOST_CHECK_EQUAL(service->getCounters().nOutInterests, 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 1);
   BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
   lp::Packet interest1pkt(transport->sentPackets.back());
   BOOST_CHECK(interest1pkt.has<lp::FragmentField>());
@@ -124,6 +125,7 @@ BOOST_AUTO_TEST_CASE(SendData)
   face->sendData(*data1);
 
   BOOST_CHECK_EQUAL(service->getCounters().nOutData, 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 1);
   BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
   lp::Packet data1pkt(transport->sentPackets.back());
   BOOST_CHECK(data1pkt.has<lp::FragmentField>());
@@ -215,6 +217,7 @@ BOOST_AUTO_TEST_CASE(ReceiveBareInterest)
   transport->receivePacket(interest1->wireEncode());
 
   BOOST_CHECK_EQUAL(service->getCounters().nInInterests, 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nInLpBypassed, 1);
   BOOST_REQUIRE_EQUAL(receivedInterests.size(), 1);
   BOOST_CHECK_EQUAL(receivedInterests.back().wireEncode(), interest1->wireEncode());
 }
@@ -234,6 +237,7 @@ BOOST_AUTO_TEST_CASE(ReceiveInterest)
   transport->receivePacket(lpPacket.wireEncode());
 
   BOOST_CHECK_EQUAL(service->getCounters().nInInterests, 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nInLpBypassed, 0);
   BOOST_REQUIRE_EQUAL(receivedInterests.size(), 1);
   BOOST_CHECK_EQUAL(receivedInterests.back().wireEncode(), interest1->wireEncode());
 }
@@ -315,6 +319,119 @@ BOOST_AUTO_TEST_CASE(ReceiveIdlePacket)
 
 BOOST_AUTO_TEST_SUITE_END() // SimpleSendReceive
 
+BOOST_AUTO_TEST_SUITE(LpBypass)
+
+BOOST_AUTO_TEST_CASE(SendWithLpFields)
+{
+  GenericLinkService::Options options;
+  options.allowLocalFields = true;
+  initialize(options);
+
+  auto interest1 = makeInterest("/Z6Q1nbpnF");
+  interest1->setTag(make_shared<lp::CongestionMarkTag>(1));
+  face->sendInterest(*interest1);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 0);
+
+  auto data1 = makeData("/Z6Q1nbpnF");
+  data1->setTag(make_shared<lp::IncomingFaceIdTag>(1000));
+  face->sendData(*data1);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 0);
+
+  // Nacks always need an LpPacket
+  lp::Nack nack1(*makeInterest("/Z6Q1nbpnF"));
+  face->sendNack(nack1);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 0);
+
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 3);
+  for (const auto& pkt : transport->sentPackets) {
+    BOOST_CHECK_EQUAL(pkt.type(), lp::tlv::LpPacket);
+  }
+
+  // without tags, the packet is sent as is
+  auto interest2 = makeInterest("/Z6Q1nbpnF");
+  face->sendInterest(*interest2);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 1);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 4);
+  BOOST_CHECK_EQUAL(transport->sentPackets.back(), interest2->wireEncode());
+}
+
+BOOST_AUTO_TEST_CASE(SendWithReliability)
+{
+  GenericLinkService::Options options;
+  options.reliabilityOptions.isEnabled = true;
+  initialize(options);
+
+  face->sendInterest(*makeInterest("/TnT7ZWXBJ"));
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 0);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  lp::Packet pkt(transport->sentPackets.back());
+  BOOST_CHECK(pkt.has<lp::SequenceField>());
+}
+
+BOOST_AUTO_TEST_CASE(SendOverMtu)
+{
+  GenericLinkService::Options options;
+  options.allowFragmentation = true;
+  initialize(options, 100);
+
+  auto data1 = makeData("/oI4Kkxqmn");
+  data1->setContent(std::vector<uint8_t>(200, 0x1));
+  face->sendData(*data1);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 0);
+  BOOST_CHECK_GT(transport->sentPackets.size(), 1);
+
+  // a small packet fits in the MTU
+  face->sendInterest(*makeInterest("/oI4Kkxqmn"));
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 1);
+}
+
+BOOST_AUTO_TEST_CASE(SendCongested)
+{
+  GenericLinkService::Options options;
+  options.allowCongestionMarking = true;
+  initialize(options, MTU_UNLIMITED, 65536);
+
+  auto interest = makeInterest("/ndbF2XEqY");
+  transport->setSendQueueLength(1000);
+  face->sendInterest(*interest);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 1);
+
+  // above target, the packet goes through congestion marking
+  transport->setSendQueueLength(65537);
+  face->sendInterest(*interest);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 1);
+  BOOST_CHECK_NE(service->m_nextMarkTime, time::steady_clock::time_point::max());
+
+  // while in a congestion incident, the packet goes through congestion marking
+  transport->setSendQueueLength(1000);
+  face->sendInterest(*interest);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 1);
+  BOOST_CHECK_EQUAL(service->m_nextMarkTime, time::steady_clock::time_point::max());
+
+  face->sendInterest(*interest);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutLpBypassed, 2);
+}
+
+BOOST_AUTO_TEST_CASE(ReceiveBare)
+{
+  GenericLinkService::Options options;
+  initialize(options);
+
+  transport->receivePacket(makeInterest("/Rq5xW8ExL")->wireEncode());
+  transport->receivePacket(makeData("/Rq5xW8ExL")->wireEncode());
+  BOOST_CHECK_EQUAL(service->getCounters().nInLpBypassed, 2);
+  BOOST_CHECK_EQUAL(receivedInterests.size(), 1);
+  BOOST_CHECK_EQUAL(receivedData.size(), 1);
+
+  // malformed bare packet
+  transport->receivePacket(ndn::encoding::makeEmptyBlock(tlv::Interest));
+  BOOST_CHECK_EQUAL(service->getCounters().nInLpBypassed, 3);
+  BOOST_CHECK_EQUAL(service->getCounters().nInNetInvalid, 1);
+  BOOST_CHECK_EQUAL(receivedInterests.size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LpBypass
+
 BOOST_AUTO_TEST_SUITE(Fragmentation)
 
 BOOST_AUTO_TEST_CASE(FragmentationDisabledExceedMtuDrop)
@@ -900,6 +1017,52 @@ BOOST_AUTO_TEST_CASE(DefaultThreshold)
   BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 0);
 }
 
+BOOST_AUTO_TEST_CASE(SojournTime)
+{
+  GenericLinkService::Options options;
+  options.allowCongestionMarking = true;
+  options.baseCongestionMarkingInterval = 100_ms;
+  initialize(options, MTU_UNLIMITED, 65536);
+
+  auto interest = makeInterest("/12345678");
+
+  // the queue is short, but the target is 100ms / 20 = 5ms
+  transport->setSendQueueLength(1000);
+  transport->setSendQueueSojournTime(5_ms);
+  face->sendInterest(*interest);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  lp::Packet pkt1(transport->sentPackets.back());
+  BOOST_CHECK_EQUAL(pkt1.count<lp::CongestionMarkField>(), 0);
+  BOOST_CHECK_EQUAL(service->m_nextMarkTime, time::steady_clock::time_point::max());
+
+  // sojourn time above target: first congested (not marked yet) packet
+  transport->setSendQueueSojournTime(6_ms);
+  face->sendInterest(*interest);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 2);
+  lp::Packet pkt2(transport->sentPackets.back());
+  BOOST_CHECK_EQUAL(pkt2.count<lp::CongestionMarkField>(), 0);
+  BOOST_CHECK_EQUAL(service->m_nextMarkTime, time::steady_clock::now() + 100_ms);
+
+  // sojourn time stays above target for one interval
+  advanceClocks(101_ms);
+  transport->setSendQueueSojournTime(20_ms);
+  face->sendInterest(*interest);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 3);
+  lp::Packet pkt3(transport->sentPackets.back());
+  BOOST_REQUIRE_EQUAL(pkt3.count<lp::CongestionMarkField>(), 1);
+  BOOST_CHECK_EQUAL(service->m_nMarkedSinceInMarkingState, 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nCongestionMarked, 1);
+
+  // sojourn time drops below target
+  transport->setSendQueueSojournTime(1_ms);
+  face->sendInterest(*interest);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 4);
+  lp::Packet pkt4(transport->sentPackets.back());
+  BOOST_CHECK_EQUAL(pkt4.count<lp::CongestionMarkField>(), 0);
+  BOOST_CHECK_EQUAL(service->m_nextMarkTime, time::steady_clock::time_point::max());
+  BOOST_CHECK_EQUAL(service->m_nMarkedSinceInMarkingState, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // CongestionMark
 
 BOOST_AUTO_TEST_SUITE(LpFields)
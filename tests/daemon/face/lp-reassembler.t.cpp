@@ -515,6 +515,162 @@ BOOST_AUTO_TEST_CASE(Normal)
 
 BOOST_AUTO_TEST_SUITE_END() // MultipleRemoteEndpoints
 
+BOOST_AUTO_TEST_SUITE(Limits)
+
+static lp::Packet
+makeFirstFragment(const ndn::Buffer& buffer, lp::Sequence seq)
+{
+  lp::Packet frag;
+  frag.add<lp::FragmentField>(std::make_pair(buffer.begin(), buffer.end()));
+  frag.add<lp::FragIndexField>(0);
+  frag.add<lp::FragCountField>(2);
+  frag.add<lp::SequenceField>(seq);
+  return frag;
+}
+
+BOOST_AUTO_TEST_CASE(EndpointQuota)
+{
+  ndn::Buffer data1Buffer(data, 5);
+  ndn::Buffer data2Buffer(data + 5, 5);
+
+  // room for exactly one partial packet of two 5-octet fragments
+  LpReassembler::Options options;
+  options.maxEndpointBytes = 2 * sizeof(lp::Packet) + 10;
+  reassembler.setOptions(options);
+
+  std::vector<EndpointId> quotaHistory;
+  reassembler.onQuotaExceeded.connect([&] (const EndpointId& ep) { quotaHistory.push_back(ep); });
+
+  const EndpointId REMOTE_EP_1 = ethernet::Address::fromString("11:22:33:45:67:89");
+  const EndpointId REMOTE_EP_2 = ethernet::Address::fromString("11:22:33:ab:cd:ef");
+  bool isComplete = false;
+
+  std::tie(isComplete, std::ignore, std::ignore) =
+    reassembler.receiveFragment(REMOTE_EP_1, makeFirstFragment(data1Buffer, 1000));
+  BOOST_TEST(!isComplete);
+  BOOST_CHECK_EQUAL(reassembler.size(), 1);
+
+  // second partial packet from the same endpoint exceeds its quota
+  std::tie(isComplete, std::ignore, std::ignore) =
+    reassembler.receiveFragment(REMOTE_EP_1, makeFirstFragment(data1Buffer, 2000));
+  BOOST_TEST(!isComplete);
+  BOOST_CHECK_EQUAL(reassembler.size(), 1);
+  BOOST_REQUIRE_EQUAL(quotaHistory.size(), 1);
+  BOOST_CHECK(quotaHistory.back() == REMOTE_EP_1);
+
+  // other endpoints are unaffected
+  std::tie(isComplete, std::ignore, std::ignore) =
+    reassembler.receiveFragment(REMOTE_EP_2, makeFirstFragment(data1Buffer, 2000));
+  BOOST_TEST(!isComplete);
+  BOOST_CHECK_EQUAL(reassembler.size(), 2);
+  BOOST_CHECK_EQUAL(quotaHistory.size(), 1);
+
+  // the partial packet within quota can still be completed
+  lp::Packet frag1_2;
+  frag1_2.add<lp::FragmentField>(std::make_pair(data2Buffer.begin(), data2Buffer.end()));
+  frag1_2.add<lp::FragIndexField>(1);
+  frag1_2.add<lp::FragCountField>(2);
+  frag1_2.add<lp::SequenceField>(1001);
+
+  Block netPacket;
+  std::tie(isComplete, netPacket, std::ignore) = reassembler.receiveFragment(REMOTE_EP_1, frag1_2);
+  BOOST_REQUIRE(isComplete);
+  BOOST_CHECK_EQUAL_COLLECTIONS(data, data + sizeof(data), netPacket.begin(), netPacket.end());
+  BOOST_CHECK_EQUAL(reassembler.size(), 1);
+  BOOST_CHECK_EQUAL(reassembler.getBufferedBytes(), 2 * sizeof(lp::Packet) + 5);
+}
+
+BOOST_AUTO_TEST_CASE(GlobalLimit)
+{
+  ndn::Buffer data1Buffer(data, 5);
+
+  // room for exactly two partial packets holding one 5-octet fragment each
+  LpReassembler::Options options;
+  options.maxBufferedBytes = 2 * (2 * sizeof(lp::Packet) + 5);
+  reassembler.setOptions(options);
+
+  std::vector<std::pair<EndpointId, size_t>> evictionHistory;
+  reassembler.beforeEviction.connect([&] (const EndpointId& ep, size_t nDroppedFragments) {
+    evictionHistory.emplace_back(ep, nDroppedFragments);
+  });
+
+  const EndpointId REMOTE_EP_1 = ethernet::Address::fromString("11:22:33:45:67:89");
+  const EndpointId REMOTE_EP_2 = ethernet::Address::fromString("11:22:33:ab:cd:ef");
+  const EndpointId REMOTE_EP_3 = ethernet::Address::fromString("11:22:33:12:34:56");
+
+  reassembler.receiveFragment(REMOTE_EP_1, makeFirstFragment(data1Buffer, 1000));
+  advanceClocks(10_ms);
+  reassembler.receiveFragment(REMOTE_EP_2, makeFirstFragment(data1Buffer, 1000));
+  BOOST_CHECK_EQUAL(reassembler.size(), 2);
+  BOOST_CHECK(evictionHistory.empty());
+
+  // the least recently active partial packet is evicted to make room
+  advanceClocks(10_ms);
+  reassembler.receiveFragment(REMOTE_EP_3, makeFirstFragment(data1Buffer, 1000));
+  BOOST_CHECK_EQUAL(reassembler.size(), 2);
+  BOOST_REQUIRE_EQUAL(evictionHistory.size(), 1);
+  BOOST_CHECK(std::get<0>(evictionHistory.back()) == REMOTE_EP_1);
+  BOOST_CHECK_EQUAL(std::get<1>(evictionHistory.back()), 1);
+  BOOST_CHECK_EQUAL(reassembler.getBufferedBytes(), options.maxBufferedBytes);
+
+  // remaining partial packets time out in order of activity
+  advanceClocks(1_ms, 490);
+  BOOST_CHECK_EQUAL(reassembler.size(), 1);
+  BOOST_REQUIRE_EQUAL(timeoutHistory.size(), 1);
+  BOOST_CHECK(std::get<0>(timeoutHistory.back()) == REMOTE_EP_2);
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK_EQUAL(reassembler.size(), 0);
+  BOOST_REQUIRE_EQUAL(timeoutHistory.size(), 2);
+  BOOST_CHECK(std::get<0>(timeoutHistory.back()) == REMOTE_EP_3);
+  BOOST_CHECK_EQUAL(reassembler.getBufferedBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GlobalLimitSkipsReceivingPacket)
+{
+  ndn::Buffer data1Buffer(data, 5);
+
+  // room for a 3-fragment and a 2-fragment partial packet holding one 5-octet fragment each
+  LpReassembler::Options options;
+  options.maxBufferedBytes = (3 * sizeof(lp::Packet) + 5) + (2 * sizeof(lp::Packet) + 5) + 2;
+  reassembler.setOptions(options);
+
+  std::vector<std::pair<EndpointId, size_t>> evictionHistory;
+  reassembler.beforeEviction.connect([&] (const EndpointId& ep, size_t nDroppedFragments) {
+    evictionHistory.emplace_back(ep, nDroppedFragments);
+  });
+
+  const EndpointId REMOTE_EP_1 = ethernet::Address::fromString("11:22:33:45:67:89");
+  const EndpointId REMOTE_EP_2 = ethernet::Address::fromString("11:22:33:ab:cd:ef");
+
+  auto makeFragment = [&] (size_t fragIndex, size_t fragCount, lp::Sequence seq) {
+    lp::Packet frag;
+    frag.add<lp::FragmentField>(std::make_pair(data1Buffer.begin(), data1Buffer.end()));
+    frag.add<lp::FragIndexField>(fragIndex);
+    frag.add<lp::FragCountField>(fragCount);
+    frag.add<lp::SequenceField>(seq);
+    return frag;
+  };
+
+  reassembler.receiveFragment(REMOTE_EP_1, makeFragment(0, 3, 1000));
+  advanceClocks(10_ms);
+  reassembler.receiveFragment(REMOTE_EP_2, makeFragment(0, 2, 2000));
+  BOOST_CHECK_EQUAL(reassembler.size(), 2);
+  advanceClocks(10_ms);
+
+  // the stalest partial packet receives the fragment, so the next-stalest one is evicted
+  bool isComplete = true;
+  std::tie(isComplete, std::ignore, std::ignore) =
+    reassembler.receiveFragment(REMOTE_EP_1, makeFragment(1, 3, 1001));
+  BOOST_CHECK(!isComplete);
+  BOOST_CHECK_EQUAL(reassembler.size(), 1);
+  BOOST_REQUIRE_EQUAL(evictionHistory.size(), 1);
+  BOOST_CHECK(std::get<0>(evictionHistory.back()) == REMOTE_EP_2);
+  BOOST_CHECK_EQUAL(std::get<1>(evictionHistory.back()), 1);
+  BOOST_CHECK_EQUAL(reassembler.getBufferedBytes(), 3 * sizeof(lp::Packet) + 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Limits
+
 BOOST_AUTO_TEST_SUITE_END() // TestLpReassembler
 BOOST_AUTO_TEST_SUITE_END() // Face
 
@@ -72,7 +72,8 @@ protected:
 
     m_face = make_unique<Face>(make_unique<DummyLinkService>(),
                                make_unique<MulticastUdpTransport>(mcastEp, std::move(sockRx), std::move(sockTx),
-                                                                  ndn::nfd::LINK_TYPE_MULTI_ACCESS));
+                                                                  ndn::nfd::LINK_TYPE_MULTI_ACCESS,
+                                                                  batchSize));
     transport = static_cast<MulticastUdpTransport*>(m_face->getTransport());
     receivedPackets = &static_cast<DummyLinkService*>(m_face->getLinkService())->receivedPackets;
 
@@ -116,6 +117,7 @@ protected:
   udp::endpoint mcastEp;
   uint16_t txPort = 7001;
   std::vector<RxPacket>* receivedPackets = nullptr;
+  size_t batchSize = 1;
 
 private:
   std::uniform_int_distribution<uint16_t> m_randomPort{10000};
@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/receive-buffer-pool.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <cstring>
+#include <set>
+
+namespace nfd::tests {
+
+using namespace nfd::face;
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_AUTO_TEST_SUITE(TestReceiveBufferPool)
+
+BOOST_AUTO_TEST_CASE(AcquireRelease)
+{
+  ReceiveBufferPool pool(1000, 2);
+  BOOST_CHECK_EQUAL(pool.getBufferSize(), 1000);
+
+  auto buf1 = pool.acquire();
+  BOOST_REQUIRE(buf1 != nullptr);
+  BOOST_CHECK_EQUAL(buf1->size(), 1000);
+  BOOST_CHECK_EQUAL(buf1.use_count(), 1);
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 1);
+
+  // an unreferenced buffer is reused right away
+  auto* ptr1 = buf1.get();
+  pool.release(std::move(buf1));
+  auto buf2 = pool.acquire();
+  BOOST_CHECK_EQUAL(buf2.get(), ptr1);
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 1);
+  BOOST_CHECK_EQUAL(pool.getNReused(), 1);
+
+  // a referenced buffer is not handed out until its last reference is dropped
+  auto ref = buf2;
+  pool.release(std::move(buf2));
+  auto buf3 = pool.acquire();
+  BOOST_CHECK_NE(buf3.get(), ptr1);
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 2);
+  ref.reset();
+  auto buf4 = pool.acquire();
+  BOOST_CHECK_EQUAL(buf4.get(), ptr1);
+  BOOST_CHECK_EQUAL(pool.getNReused(), 2);
+
+  // buffers of another size are not kept
+  pool.release(make_shared<ndn::Buffer>(10));
+  auto buf5 = pool.acquire();
+  BOOST_CHECK_EQUAL(buf5->size(), 1000);
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  ReceiveBufferPool pool(1000, 2);
+  std::vector<shared_ptr<ndn::Buffer>> refs;
+  for (int i = 0; i < 3; ++i) {
+    auto buf = pool.acquire();
+    refs.push_back(buf);
+    pool.release(std::move(buf));
+  }
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 3);
+
+  // the oldest buffer was forgotten by the pool, the other two are recycled
+  refs.clear();
+  std::set<ndn::Buffer*> recycled;
+  recycled.insert(pool.acquire().get());
+  auto keep = pool.acquire();
+  recycled.insert(keep.get());
+  BOOST_CHECK_EQUAL(recycled.size(), 2);
+  BOOST_CHECK_EQUAL(pool.getNReused(), 2);
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(Decode)
+{
+  ReceiveBufferPool pool(1000);
+  BOOST_CHECK_EQUAL(pool.getZeroCopyThreshold(), 250);
+  auto buf = pool.acquire();
+
+  // large element: references the receive buffer
+  auto large = ndn::encoding::makeBinaryBlock(300, std::vector<uint8_t>(400, 0xAB));
+  std::memcpy(buf->data(), large.data(), large.size());
+  // small element: copied
+  auto small = ndn::encoding::makeStringBlock(301, "hello");
+  std::memcpy(buf->data() + large.size(), small.data(), small.size());
+  size_t total = large.size() + small.size();
+
+  auto bytes = ndn::make_span(*buf).first(total);
+  auto [isOk1, element1] = pool.decode(buf, bytes);
+  BOOST_REQUIRE(isOk1);
+  BOOST_CHECK(element1 == large);
+  BOOST_CHECK_EQUAL(element1.data(), buf->data());
+  BOOST_CHECK_EQUAL(buf.use_count(), 2);
+
+  bytes = bytes.subspan(element1.size());
+  auto [isOk2, element2] = pool.decode(buf, bytes);
+  BOOST_REQUIRE(isOk2);
+  BOOST_CHECK(element2 == small);
+  BOOST_CHECK_NE(element2.data(), bytes.data());
+  BOOST_CHECK_EQUAL(buf.use_count(), 2);
+
+  // truncated element
+  auto [isOk3, element3] = pool.decode(buf, ndn::make_span(*buf).first(large.size() - 1));
+  BOOST_CHECK(!isOk3);
+  auto [isOk4, element4] = pool.decode(buf, ndn::make_span(*buf).first(0));
+  BOOST_CHECK(!isOk4);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestReceiveBufferPool
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace nfd::tests
@@ -69,6 +69,34 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Send, T, StreamTransportFixtures, T)
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendCoalesced, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // enough packets to need more than one scatter-gather write
+  constexpr size_t nPackets = StreamTransport<boost::asio::ip::tcp>::MAX_SEND_BATCH_PACKETS * 3 + 1;
+  std::vector<uint8_t> expected;
+  for (size_t i = 0; i < nPackets; ++i) {
+    auto block = ndn::encoding::makeStringBlock(300, "packet" + std::to_string(i));
+    this->transport->send(block);
+    expected.insert(expected.end(), block.begin(), block.end());
+  }
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutPackets, nPackets);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutBytes, expected.size());
+
+  std::vector<uint8_t> readBuf(expected.size());
+  boost::asio::async_read(this->remoteSocket, boost::asio::buffer(readBuf),
+    [this] (const boost::system::error_code& error, size_t) {
+      BOOST_REQUIRE_EQUAL(error, boost::system::errc::success);
+      this->limitedIo.afterOp();
+    });
+
+  BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveNormal, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
@@ -48,7 +48,8 @@ protected:
       port = getNextPort();
 
     return std::make_shared<UdpChannel>(udp::Endpoint(addr, port), 2_s, false,
-                                        mtu.value_or(ndn::MAX_NDN_PACKET_SIZE));
+                                        mtu.value_or(ndn::MAX_NDN_PACKET_SIZE),
+                                        1, wantSharedSocket, nRxThreads);
   }
 
   void
@@ -69,6 +70,8 @@ protected:
 
 protected:
   std::vector<shared_ptr<Face>> clientFaces;
+  bool wantSharedSocket = false;
+  size_t nRxThreads = 0;
 };
 
 } // namespace nfd::tests
@@ -25,6 +25,8 @@
 
 #include "udp-channel-fixture.hpp"
 
+#include "face/shared-udp-transport.hpp"
+
 #include "test-ip.hpp"
 
 #include <boost/mp11/list.hpp>
@@ -58,6 +60,97 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(DefaultMtu, F, AddressFamilies)
   }
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(SharedSocket, F, AddressFamilies)
+{
+  auto address = getTestIp(F::value, AddressScope::Loopback);
+  SKIP_IF_IP_UNAVAILABLE(address);
+  this->wantSharedSocket = true;
+  this->listen(address);
+  this->wantSharedSocket = false;
+  BOOST_CHECK_EQUAL(this->listenerChannel->hasSharedSocket(), true);
+
+  auto ch1 = this->makeChannel(IpAddressTypeFromFamily<F::value>());
+  connect(*ch1);
+  auto ch2 = this->makeChannel(IpAddressTypeFromFamily<F::value>());
+  connect(*ch2);
+
+  // two client faces, and two faces on the shared socket of the listener
+  BOOST_CHECK_EQUAL(this->limitedIo.run(4, 1_s), LimitedIo::EXCEED_OPS);
+  BOOST_CHECK_EQUAL(this->listenerChannel->size(), 2);
+  BOOST_REQUIRE_EQUAL(this->listenerFaces.size(), 2);
+  BOOST_REQUIRE_EQUAL(this->clientFaces.size(), 2);
+  for (const auto& face : this->listenerFaces) {
+    BOOST_CHECK(dynamic_cast<face::SharedUdpTransport*>(face->getTransport()) != nullptr);
+    BOOST_CHECK_EQUAL(face->getLocalUri(), this->listenerChannel->getUri());
+  }
+
+  // subsequent datagrams are demultiplexed to the existing faces
+  for (const auto& face : this->clientFaces) {
+    face->getTransport()->send(ndn::encoding::makeStringBlock(300, "world"));
+  }
+  this->limitedIo.defer(500_ms);
+  BOOST_CHECK_EQUAL(this->listenerChannel->size(), 2);
+  for (const auto& face : this->listenerFaces) {
+    BOOST_CHECK_EQUAL(face->getTransport()->getCounters().nInPackets, 2);
+  }
+
+  // replies are sent through the shared socket to the right peer
+  for (const auto& face : this->listenerFaces) {
+    face->getTransport()->send(ndn::encoding::makeStringBlock(300, "reply"));
+    auto transport = static_cast<face::SharedUdpTransport*>(face->getTransport());
+    BOOST_CHECK_EQUAL(transport->getNSendDrops(), 0);
+  }
+  this->limitedIo.defer(500_ms);
+  for (const auto& face : this->clientFaces) {
+    BOOST_CHECK_EQUAL(face->getTransport()->getCounters().nInPackets, 1);
+  }
+}
+
+#ifdef __linux__
+BOOST_AUTO_TEST_CASE_TEMPLATE(SharedSocketRxThreads, F, AddressFamilies)
+{
+  auto address = getTestIp(F::value, AddressScope::Loopback);
+  SKIP_IF_IP_UNAVAILABLE(address);
+  this->wantSharedSocket = true;
+  this->nRxThreads = 2;
+  this->listen(address);
+  this->wantSharedSocket = false;
+  this->nRxThreads = 0;
+
+  // datagrams from each client are received by the main socket or one of the receive threads
+  std::vector<shared_ptr<UdpChannel>> clientChannels;
+  for (int i = 0; i < 4; ++i) {
+    clientChannels.push_back(this->makeChannel(IpAddressTypeFromFamily<F::value>()));
+    connect(*clientChannels.back());
+  }
+
+  BOOST_CHECK_EQUAL(this->limitedIo.run(8, 1_s), LimitedIo::EXCEED_OPS);
+  BOOST_CHECK_EQUAL(this->listenerChannel->size(), 4);
+  BOOST_REQUIRE_EQUAL(this->listenerFaces.size(), 4);
+  for (const auto& face : this->listenerFaces) {
+    BOOST_CHECK_EQUAL(face->getTransport()->getCounters().nInPackets, 1);
+  }
+}
+#endif // __linux__
+
+BOOST_AUTO_TEST_CASE(SharedSocketNotListening)
+{
+  this->wantSharedSocket = true;
+  auto channel = this->makeChannel(boost::asio::ip::address_v4::loopback());
+
+  bool hasFailed = false;
+  channel->connect(udp::Endpoint(boost::asio::ip::address_v4::loopback(), 7030), {},
+    [] (const shared_ptr<Face>&) {
+      BOOST_ERROR("Unexpected face creation");
+    },
+    [&] (uint32_t status, const std::string&) {
+      BOOST_CHECK_EQUAL(status, 504);
+      hasFailed = true;
+    });
+  BOOST_CHECK(hasFailed);
+  BOOST_CHECK_EQUAL(channel->size(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestUdpChannel
 BOOST_AUTO_TEST_SUITE_END() // Face
 
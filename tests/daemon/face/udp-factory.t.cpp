@@ -774,6 +774,133 @@ BOOST_AUTO_TEST_CASE(BadMtu)
   BOOST_CHECK_THROW(parseConfig(CONFIG3, false), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(BatchSize)
+{
+  const std::string CONFIG1 = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        batch_size 32
+        mcast no
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_NO_THROW(parseConfig(CONFIG1, true));
+  BOOST_CHECK_NO_THROW(parseConfig(CONFIG1, false));
+
+  // underflow
+  const std::string CONFIG2 = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        batch_size 0
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG2, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG2, false), ConfigFile::Error);
+
+  // overflow
+  const std::string CONFIG3 = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        batch_size 1025
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG3, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG3, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(SharedSocket)
+{
+  const std::string CONFIG1 = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        port 7001
+        shared_socket yes
+        mcast no
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG1, true);
+  parseConfig(CONFIG1, false);
+
+  checkChannelListEqual(factory, {"udp4://0.0.0.0:7001", "udp6://[::]:7001"});
+  for (const auto& ch : factory.getChannels()) {
+    BOOST_CHECK_EQUAL(std::static_pointer_cast<const UdpChannel>(ch)->hasSharedSocket(), true);
+  }
+
+  // shared socket without listen
+  const std::string CONFIG2 = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        listen no
+        shared_socket yes
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG2, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG2, false), ConfigFile::Error);
+
+  // receive threads without shared socket
+  const std::string CONFIG3 = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        rx_threads 2
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG3, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG3, false), ConfigFile::Error);
+
+  // too many receive threads
+  const std::string CONFIG4 = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        shared_socket yes
+        rx_threads 65
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG4, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG4, false), ConfigFile::Error);
+
+  // batching is not supported on a shared socket
+  const std::string CONFIG5 = R"CONFIG(
+    face_system
+    {
+      udp
+      {
+        shared_socket yes
+        batch_size 16
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(parseConfig(CONFIG5, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG5, false), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE(BadMcast)
 {
   const std::string CONFIG = R"CONFIG(
@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/udp-rx-thread.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+#include "tests/daemon/limited-io.hpp"
+
+namespace nfd::tests {
+
+using face::UdpRxThread;
+namespace ip = boost::asio::ip;
+
+#ifdef __linux__
+
+class UdpRxThreadFixture : public GlobalIoFixture
+{
+protected:
+  UdpRxThreadFixture()
+  {
+    rx = std::make_shared<UdpRxThread>(localEp, [this] (const auto& sender, const auto& element) {
+      senders.push_back(sender);
+      elements.push_back(element);
+      limitedIo.afterOp();
+    });
+    rx->start();
+
+    remoteSocket.open(ip::udp::v4());
+    remoteSocket.bind(ip::udp::endpoint(ip::address_v4::loopback(), 0));
+  }
+
+  void
+  remoteWrite(const Block& block)
+  {
+    remoteSocket.send_to(boost::asio::buffer(block), localEp);
+  }
+
+protected:
+  LimitedIo limitedIo;
+  const ip::udp::endpoint localEp{ip::address_v4::loopback(), 7080};
+  shared_ptr<UdpRxThread> rx;
+  ip::udp::socket remoteSocket{g_io};
+  std::vector<udp::Endpoint> senders;
+  std::vector<Block> elements;
+};
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestUdpRxThread, UdpRxThreadFixture)
+
+BOOST_AUTO_TEST_CASE(Receive)
+{
+  auto pkt1 = ndn::encoding::makeStringBlock(300, "hello");
+  auto pkt2 = ndn::encoding::makeStringBlock(301, "world");
+  remoteWrite(pkt1);
+  remoteWrite(pkt2);
+
+  BOOST_REQUIRE_EQUAL(limitedIo.run(2, 1_s), LimitedIo::EXCEED_OPS);
+  BOOST_REQUIRE_EQUAL(elements.size(), 2);
+  BOOST_CHECK(elements[0] == pkt1);
+  BOOST_CHECK(elements[1] == pkt2);
+  BOOST_CHECK_EQUAL(senders[0], remoteSocket.local_endpoint());
+  BOOST_CHECK_EQUAL(senders[1], remoteSocket.local_endpoint());
+  BOOST_CHECK_EQUAL(rx->getNDropped(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  const std::vector<uint8_t> incomplete{0x05, 0x03, 0x00, 0x01};
+  remoteSocket.send_to(boost::asio::buffer(incomplete), localEp);
+  auto pkt1 = ndn::encoding::makeStringBlock(300, "hello");
+  remoteWrite(pkt1);
+
+  BOOST_REQUIRE_EQUAL(limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+  limitedIo.defer(100_ms);
+  BOOST_REQUIRE_EQUAL(elements.size(), 1);
+  BOOST_CHECK(elements[0] == pkt1);
+}
+
+BOOST_AUTO_TEST_CASE(ShareEndpoint)
+{
+  // a second receiver can bind to the same endpoint
+  std::shared_ptr<UdpRxThread> rx2;
+  BOOST_CHECK_NO_THROW(rx2 = std::make_shared<UdpRxThread>(localEp, [] (auto&&...) {}));
+
+  // a socket without SO_REUSEPORT cannot
+  ip::udp::socket socket(g_io, ip::udp::v4());
+  boost::system::error_code ec;
+  socket.bind(localEp, ec);
+  BOOST_CHECK(ec);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestUdpRxThread
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+#endif // __linux__
+
+} // namespace nfd::tests
@@ -54,7 +54,8 @@ protected:
     remoteConnect(address);
 
     m_face = make_unique<Face>(make_unique<DummyLinkService>(),
-                               make_unique<UnicastUdpTransport>(std::move(sock), persistency, 3_s));
+                               make_unique<UnicastUdpTransport>(std::move(sock), persistency, 3_s,
+                                                                batchSize));
     transport = static_cast<UnicastUdpTransport*>(m_face->getTransport());
     receivedPackets = &static_cast<DummyLinkService*>(m_face->getLinkService())->receivedPackets;
 
@@ -102,6 +103,7 @@ protected:
   udp::endpoint localEp;
   udp::socket remoteSocket{g_io};
   std::vector<RxPacket>* receivedPackets = nullptr;
+  size_t batchSize = 1;
 
 private:
   unique_ptr<Face> m_face;
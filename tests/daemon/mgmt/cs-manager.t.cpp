@@ -24,6 +24,7 @@
  */
 
 #include "mgmt/cs-manager.hpp"
+#include "mgmt/status-tlv.hpp"
 
 #include "manager-common-fixture.hpp"
 
@@ -189,8 +190,12 @@ BOOST_AUTO_TEST_CASE(Erase)
 BOOST_AUTO_TEST_CASE(Info)
 {
   m_cs.setLimit(2681);
+  m_cs.setLimitBytes(1048576);
+  size_t nBytes = 0;
   for (uint64_t i = 0; i < 310; ++i) {
-    m_cs.insert(*makeData(Name("/Q8H4oi4g").appendSequenceNumber(i)));
+    auto data = makeData(Name("/Q8H4oi4g").appendSequenceNumber(i));
+    nBytes += data->wireEncode().size();
+    m_cs.insert(*data);
   }
   m_cs.enableAdmit(false);
   m_cs.enableServe(true);
@@ -209,6 +214,13 @@ BOOST_AUTO_TEST_CASE(Info)
   BOOST_CHECK_EQUAL(info.getNEntries(), 310);
   BOOST_CHECK_EQUAL(info.getNHits(), 362);
   BOOST_CHECK_EQUAL(info.getNMisses(), 1493);
+
+  const Block& infoWire = *dataset.elements_begin();
+  infoWire.parse();
+  BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(infoWire.get(tlv::CsMaxBytes)),
+                    1048576);
+  BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(infoWire.get(tlv::CsNBytes)),
+                    nBytes);
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestCsManager
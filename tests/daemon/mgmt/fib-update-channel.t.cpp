@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mgmt/fib-update-channel.hpp"
+#include "fw/face-table.hpp"
+#include "table/fib.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+namespace nfd::tests {
+
+using rib::FibUpdate;
+
+class FibUpdateChannelFixture : public GlobalIoFixture
+{
+protected:
+  FibUpdateChannelFixture()
+  {
+    faceTable.add(face1);
+    faceTable.add(face2);
+  }
+
+  /** \brief Submit \p updates and poll until the result is delivered.
+   *  \return 200 on success, or the failure code
+   */
+  uint32_t
+  submitAndWait(std::vector<FibUpdate> updates, uint64_t batchFaceId)
+  {
+    uint32_t result = 0;
+    channel.submit(std::move(updates), batchFaceId,
+                   [&] { result = 200; },
+                   [&] (uint32_t code, const std::string&) { result = code; });
+    pollIo();
+    return result;
+  }
+
+protected:
+  FaceTable faceTable;
+  NameTree nameTree;
+  Fib fib{nameTree};
+  FibUpdateChannel channel{fib, faceTable, g_io};
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+};
+
+BOOST_AUTO_TEST_SUITE(Mgmt)
+BOOST_FIXTURE_TEST_SUITE(TestFibUpdateChannel, FibUpdateChannelFixture)
+
+BOOST_AUTO_TEST_CASE(AddRemove)
+{
+  uint64_t id1 = face1->getId();
+  uint64_t id2 = face2->getId();
+
+  BOOST_CHECK_EQUAL(submitAndWait({FibUpdate::createAddUpdate("/A", id1, 10),
+                                   FibUpdate::createAddUpdate("/A", id2, 20),
+                                   FibUpdate::createAddUpdate("/A/B", id2, 5)}, id1), 200);
+  const fib::Entry* entryA = fib.findExactMatch("/A");
+  BOOST_REQUIRE(entryA != nullptr);
+  BOOST_CHECK(entryA->hasNextHop(*face1));
+  BOOST_CHECK(entryA->hasNextHop(*face2));
+  BOOST_CHECK_EQUAL(fib.size(), 2);
+
+  BOOST_CHECK_EQUAL(submitAndWait({FibUpdate::createRemoveUpdate("/A", id1),
+                                   FibUpdate::createRemoveUpdate("/A/B", id2),
+                                   FibUpdate::createRemoveUpdate("/C", id2)}, id1), 200);
+  BOOST_REQUIRE(fib.findExactMatch("/A") != nullptr);
+  BOOST_CHECK(!fib.findExactMatch("/A")->hasNextHop(*face1));
+  BOOST_CHECK(fib.findExactMatch("/A/B") == nullptr);
+
+  const auto& counters = channel.getCounters();
+  BOOST_CHECK_EQUAL(counters.nBatches.load(), 2);
+  BOOST_CHECK_EQUAL(counters.nFailedBatches.load(), 0);
+  BOOST_CHECK_EQUAL(counters.nUpdates.load(), 6);
+}
+
+BOOST_AUTO_TEST_CASE(FailureIsAtomic)
+{
+  uint64_t id1 = face1->getId();
+  uint64_t missingId = 65535;
+
+  // nonexistent batch face fails the whole batch
+  BOOST_CHECK_EQUAL(submitAndWait({FibUpdate::createAddUpdate("/A", id1, 10),
+                                   FibUpdate::createAddUpdate("/B", missingId, 10)}, missingId), 410);
+  BOOST_CHECK_EQUAL(fib.size(), 0);
+
+  // prefix exceeding the depth limit fails the whole batch
+  Name tooLong;
+  for (size_t i = 0; i <= Fib::getMaxDepth(); ++i) {
+    tooLong.append("x");
+  }
+  BOOST_CHECK_EQUAL(submitAndWait({FibUpdate::createAddUpdate("/A", id1, 10),
+                                   FibUpdate::createAddUpdate(tooLong, id1, 10)}, id1), 414);
+  BOOST_CHECK_EQUAL(fib.size(), 0);
+
+  // nonexistent face other than the batch face is skipped
+  BOOST_CHECK_EQUAL(submitAndWait({FibUpdate::createAddUpdate("/A", id1, 10),
+                                   FibUpdate::createAddUpdate("/B", missingId, 10)}, id1), 200);
+  BOOST_CHECK_EQUAL(fib.size(), 1);
+  BOOST_CHECK(fib.findExactMatch("/B") == nullptr);
+
+  BOOST_CHECK_EQUAL(channel.getCounters().nBatches.load(), 3);
+  BOOST_CHECK_EQUAL(channel.getCounters().nFailedBatches.load(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ChannelDestroyed)
+{
+  auto other = make_unique<FibUpdateChannel>(fib, faceTable, g_io);
+  bool hasResult = false;
+  other->submit({FibUpdate::createAddUpdate("/A", face1->getId(), 10)}, face1->getId(),
+                [&] { hasResult = true; },
+                [&] (auto&&...) { hasResult = true; });
+  other.reset();
+  pollIo();
+  BOOST_CHECK(!hasResult);
+  BOOST_CHECK_EQUAL(fib.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFibUpdateChannel
+BOOST_AUTO_TEST_SUITE_END() // Mgmt
+
+} // namespace nfd::tests
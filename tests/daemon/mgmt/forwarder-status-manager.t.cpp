@@ -24,10 +24,16 @@
  */
 
 #include "mgmt/forwarder-status-manager.hpp"
+#include "mgmt/fib-update-channel.hpp"
+#include "mgmt/status-tlv.hpp"
 #include "core/version.hpp"
 
 #include "manager-common-fixture.hpp"
 
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+#include <map>
+
 namespace nfd::tests {
 
 class ForwarderStatusManagerFixture : public ManagerCommonFixture
@@ -35,7 +41,8 @@ class ForwarderStatusManagerFixture : public ManagerCommonFixture
 protected:
   ForwarderStatusManagerFixture()
     : m_forwarder(m_faceTable)
-    , m_manager(m_forwarder, m_dispatcher)
+    , m_fibUpdateChannel(m_forwarder.getFib(), m_faceTable, g_io)
+    , m_manager(m_forwarder, m_dispatcher, &m_fibUpdateChannel)
     , m_startTime(time::system_clock::now())
   {
     setTopPrefix();
@@ -44,6 +51,7 @@ protected:
 protected:
   FaceTable m_faceTable;
   Forwarder m_forwarder;
+  FibUpdateChannel m_fibUpdateChannel;
   ForwarderStatusManager m_manager;
   time::system_clock::time_point m_startTime;
 };
@@ -104,6 +112,35 @@ BOOST_AUTO_TEST_CASE(GeneralStatusDataset)
 
   BOOST_CHECK_EQUAL(status.getNSatisfiedInterests(), m_forwarder.getCounters().nSatisfiedInterests);
   BOOST_CHECK_EQUAL(status.getNUnsatisfiedInterests(), m_forwarder.getCounters().nUnsatisfiedInterests);
+
+  // memory pool and FIB update channel statistics follow the ForwarderStatus fields
+  std::map<std::string, Block> pools;
+  std::optional<Block> channelStatus;
+  content.parse();
+  for (const auto& element : content.elements()) {
+    if (element.type() == tlv::MemoryPoolStatus) {
+      element.parse();
+      pools[ndn::encoding::readString(element.get(tlv::MemoryPoolName))] = element;
+    }
+    else if (element.type() == tlv::FibUpdateChannelStatus) {
+      element.parse();
+      channelStatus = element;
+    }
+  }
+  BOOST_REQUIRE_EQUAL(pools.count("name-tree-node"), 1);
+
+  const Block& nodePool = pools["name-tree-node"];
+  auto nInUse = ndn::encoding::readNonNegativeInteger(nodePool.get(tlv::MemoryPoolNInUse));
+  auto capacity = ndn::encoding::readNonNegativeInteger(nodePool.get(tlv::MemoryPoolCapacity));
+  BOOST_CHECK_GE(nInUse, m_forwarder.getNameTree().size());
+  BOOST_CHECK_GE(capacity, nInUse);
+  BOOST_CHECK_GT(ndn::encoding::readNonNegativeInteger(nodePool.get(tlv::MemoryPoolBlockSize)), 0);
+
+  BOOST_REQUIRE(channelStatus);
+  BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(channelStatus->get(tlv::FibUpdateNBatches)),
+                    m_fibUpdateChannel.getCounters().nBatches.load());
+  BOOST_CHECK_EQUAL(ndn::encoding::readNonNegativeInteger(channelStatus->get(tlv::FibUpdateApplyTime)),
+                    m_fibUpdateChannel.getCounters().applyTime.load());
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestForwarderStatusManager
@@ -151,6 +151,58 @@ BOOST_AUTO_TEST_CASE(InvalidValue)
 
 BOOST_AUTO_TEST_SUITE_END() // CsMaxPackets
 
+BOOST_AUTO_TEST_SUITE(CsMaxBytes)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  cs.setLimitBytes(4096);
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(cs.getLimitBytes(), 4096);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(cs.getLimitBytes(), std::numeric_limits<size_t>::max());
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_max_bytes 1048576
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_NE(cs.getLimitBytes(), 1048576);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(cs.getLimitBytes(), 1048576);
+
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_EQUAL(cs.getLimitBytes(), 1048576);
+}
+
+BOOST_AUTO_TEST_CASE(Invalid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_max_bytes -1
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsMaxBytes
+
 BOOST_AUTO_TEST_SUITE(CsPolicy)
 
 BOOST_AUTO_TEST_CASE(Default)
@@ -199,6 +251,52 @@ BOOST_AUTO_TEST_CASE(Unknown)
 
 BOOST_AUTO_TEST_SUITE_END() // CsPolicy
 
+BOOST_AUTO_TEST_SUITE(CsNameIndex)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  cs.enableNameIndex(true);
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(cs.hasNameIndex(), false);
+}
+
+BOOST_AUTO_TEST_CASE(Enable)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_name_index yes
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, true);
+  BOOST_CHECK_EQUAL(cs.hasNameIndex(), false);
+
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(cs.hasNameIndex(), true);
+}
+
+BOOST_AUTO_TEST_CASE(BadValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_name_index sometimes
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsNameIndex
+
 class CsUnsolicitedPolicyFixture : public TablesConfigSectionFixture
 {
 protected:
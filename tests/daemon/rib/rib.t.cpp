@@ -101,6 +101,41 @@ BOOST_AUTO_TEST_CASE(Children)
   BOOST_CHECK_EQUAL((rib.find(name3)->second)->getParent()->getName(), name4);
 }
 
+BOOST_AUTO_TEST_CASE(ParentAfterErase)
+{
+  rib::Rib rib;
+
+  Route route1 = createRoute(1, 20);
+  rib.insert("/a", route1);
+  Route route2 = createRoute(2, 20);
+  rib.insert("/a/b/c", route2);
+  Route route3 = createRoute(3, 20);
+  rib.insert("/a/b/c/d", route3);
+
+  BOOST_REQUIRE(rib.findParent("/a/b/c/d") != nullptr);
+  BOOST_CHECK_EQUAL(rib.findParent("/a/b/c/d")->getName(), "/a/b/c");
+  BOOST_REQUIRE(rib.findParent("/a/b/x") != nullptr);
+  BOOST_CHECK_EQUAL(rib.findParent("/a/b/x")->getName(), "/a");
+  BOOST_CHECK(rib.findParent("/a") == nullptr);
+  BOOST_CHECK(rib.findParent("/") == nullptr);
+
+  rib.erase("/a/b/c", route2);
+  BOOST_REQUIRE(rib.findParent("/a/b/c/d") != nullptr);
+  BOOST_CHECK_EQUAL(rib.findParent("/a/b/c/d")->getName(), "/a");
+  BOOST_CHECK_EQUAL(rib.find("/a/b/c/d")->second->getParent()->getName(), "/a");
+
+  rib.erase("/a/b/c/d", route3);
+  BOOST_CHECK_EQUAL(rib.find("/a")->second->getChildren().size(), 0);
+
+  // re-inserting below the erased names must not see stale entries
+  rib.insert("/a/b/c/d/e", route3);
+  BOOST_CHECK_EQUAL(rib.find("/a/b/c/d/e")->second->getParent()->getName(), "/a");
+
+  rib.insert("/a/b", route2);
+  BOOST_CHECK_EQUAL(rib.find("/a/b/c/d/e")->second->getParent()->getName(), "/a/b");
+  BOOST_CHECK_EQUAL(rib.find("/a")->second->getChildren().size(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(EraseFace)
 {
   rib::Rib rib;
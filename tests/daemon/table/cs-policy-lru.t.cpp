@@ -79,6 +79,58 @@ BOOST_FIXTURE_TEST_CASE(EvictOne, CsFixture)
   CHECK_CS_FIND(0);
 }
 
+BOOST_FIXTURE_TEST_CASE(EvictBytes, CsFixture)
+{
+  cs.setPolicy(make_unique<cs::LruPolicy>());
+  cs.setLimit(100);
+
+  auto setSize = [] (size_t sigSize) {
+    return [=] (Data& data) { data.setSignatureValue(std::make_shared<ndn::Buffer>(sigSize)); };
+  };
+
+  insert(1, "/A", setSize(1000));
+  size_t entrySize = cs.getNBytes();
+  BOOST_CHECK_GT(entrySize, 1000);
+  cs.setLimitBytes(entrySize * 3);
+
+  insert(2, "/B", setSize(1000));
+  insert(3, "/C", setSize(1000));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), entrySize * 3);
+
+  // evict A
+  insert(4, "/D", setSize(1000));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+
+  // use B; a larger packet evicts C then D
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+  insert(5, "/E", setSize(1500));
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_LE(cs.getNBytes(), entrySize * 3);
+  startInterest("/C");
+  CHECK_CS_FIND(0);
+  startInterest("/D");
+  CHECK_CS_FIND(0);
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+
+  // a packet larger than the limit is not admitted and does not cause eviction
+  insert(6, "/F", setSize(entrySize * 3));
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  startInterest("/F");
+  CHECK_CS_FIND(0);
+
+  // lowering the limit evicts E, which was used less recently than B
+  cs.setLimitBytes(entrySize);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), entrySize);
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCsLru
 BOOST_AUTO_TEST_SUITE_END() // Table
 
@@ -94,6 +94,39 @@ BOOST_FIXTURE_TEST_CASE(Refresh, CsFixture)
   CHECK_CS_FIND(0);
 }
 
+BOOST_FIXTURE_TEST_CASE(EvictBytes, CsFixture)
+{
+  cs.setPolicy(make_unique<cs::PriorityFifoPolicy>());
+  cs.setLimit(100);
+
+  auto setFreshAndSize = [] (size_t sigSize) {
+    return [=] (Data& data) {
+      data.setFreshnessPeriod(99999_ms);
+      data.setSignatureValue(std::make_shared<ndn::Buffer>(sigSize));
+    };
+  };
+
+  insert(1, "/A", setFreshAndSize(1000));
+  size_t entrySize = cs.getNBytes();
+  cs.setLimitBytes(entrySize * 3);
+  insert(2, "/B", setFreshAndSize(1000), true);
+  insert(3, "/C", setFreshAndSize(1000));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+
+  // a packet of double size evicts /B (unsolicited) then /A (fresh, oldest)
+  insert(4, "/D", setFreshAndSize(2000));
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_LE(cs.getNBytes(), entrySize * 3);
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+  startInterest("/B");
+  CHECK_CS_FIND(0);
+  startInterest("/C");
+  CHECK_CS_FIND(3);
+  startInterest("/D");
+  CHECK_CS_FIND(4);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCsPriorityFifo
 BOOST_AUTO_TEST_SUITE_END() // Table
 
@@ -24,6 +24,7 @@
  */
 
 #include "table/cs.hpp"
+#include "table/cs-policy-lru.hpp"
 
 #include "tests/daemon/table/cs-fixture.hpp"
 
@@ -143,6 +144,163 @@ BOOST_AUTO_TEST_CASE(MustBeFresh)
 
 BOOST_AUTO_TEST_SUITE_END() // Find
 
+class CsNameIndexFixture : public CsFixture
+{
+protected:
+  CsNameIndexFixture()
+  {
+    cs.enableNameIndex(true);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(NameIndex, CsNameIndexFixture)
+
+BOOST_AUTO_TEST_CASE(ExactName)
+{
+  insert(1, "/");
+  insert(2, "/A");
+  insert(3, "/A/B");
+  insert(4, "/A/C");
+  insert(5, "/D");
+
+  startInterest("/A");
+  CHECK_CS_FIND(2);
+
+  startInterest("/");
+  CHECK_CS_FIND(1);
+
+  startInterest("/A/B");
+  CHECK_CS_FIND(3);
+
+  startInterest("/E");
+  CHECK_CS_FIND(0);
+}
+
+BOOST_AUTO_TEST_CASE(SameName)
+{
+  // the match must be the same as that found by the ordered lookup, i.e. the lowest full name
+  Name n1 = insert(1, "/A");
+  Name n2 = insert(2, "/A");
+  uint32_t expected = n1 < n2 ? 1 : 2;
+
+  startInterest("/A");
+  CHECK_CS_FIND(expected);
+
+  cs.enableNameIndex(false);
+  startInterest("/A");
+  CHECK_CS_FIND(expected);
+}
+
+BOOST_AUTO_TEST_CASE(FullName)
+{
+  Name n1 = insert(1, "/A");
+  Name n2 = insert(2, "/A");
+  Name n3 = insert(3, "/");
+
+  startInterest(n1);
+  CHECK_CS_FIND(1);
+
+  startInterest(n2);
+  CHECK_CS_FIND(2);
+
+  startInterest(n3);
+  CHECK_CS_FIND(3);
+
+  startInterest(Name("/B").append(n1[-1]));
+  CHECK_CS_FIND(0);
+}
+
+BOOST_AUTO_TEST_CASE(PrefixName)
+{
+  insert(1, "/B/p/1");
+
+  startInterest("/B");
+  CHECK_CS_FIND(0);
+
+  startInterest("/B")
+    .setCanBePrefix(true);
+  CHECK_CS_FIND(1);
+}
+
+BOOST_AUTO_TEST_CASE(MustBeFresh)
+{
+  insert(1, "/A", [] (Data& data) { data.setFreshnessPeriod(1_s); });
+
+  advanceClocks(500_ms);
+  startInterest("/A")
+    .setMustBeFresh(true);
+  CHECK_CS_FIND(1);
+
+  advanceClocks(1_s);
+  startInterest("/A")
+    .setMustBeFresh(true);
+  CHECK_CS_FIND(0);
+
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  insert(1, "/A/B/1");
+  insert(2, "/A/B/2");
+  insert(3, "/D/3");
+
+  BOOST_CHECK_EQUAL(erase("/A", 5), 2);
+  startInterest("/A/B/1");
+  CHECK_CS_FIND(0);
+  startInterest("/A/B/2");
+  CHECK_CS_FIND(0);
+  startInterest("/D/3");
+  CHECK_CS_FIND(3);
+
+  insert(4, "/A/B/1");
+  startInterest("/A/B/1");
+  CHECK_CS_FIND(4);
+}
+
+BOOST_AUTO_TEST_CASE(Evict)
+{
+  cs.setLimit(2);
+  insert(1, "/A");
+  insert(2, "/B");
+  insert(3, "/C");
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+  startInterest("/C");
+  CHECK_CS_FIND(3);
+}
+
+BOOST_AUTO_TEST_CASE(Toggle)
+{
+  cs.enableNameIndex(false);
+  BOOST_CHECK_EQUAL(cs.hasNameIndex(), false);
+  insert(1, "/A");
+  insert(2, "/B");
+
+  // enabling the index picks up existing entries
+  cs.enableNameIndex(true);
+  BOOST_CHECK_EQUAL(cs.hasNameIndex(), true);
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+
+  cs.enableNameIndex(false);
+  BOOST_CHECK_EQUAL(erase("/A", 1), 1);
+  cs.enableNameIndex(true);
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // NameIndex
+
 BOOST_AUTO_TEST_CASE(Erase)
 {
   insert(1, "/A/B/1");
@@ -194,6 +352,56 @@ BOOST_AUTO_TEST_CASE(ZeroCapacity)
   CHECK_CS_FIND(0);
 }
 
+BOOST_AUTO_TEST_CASE(ByteAccounting)
+{
+  BOOST_CHECK_EQUAL(cs.getNBytes(), 0);
+
+  insert(1, "/A");
+  size_t sizeA = cs.getNBytes();
+  BOOST_CHECK_GT(sizeA, 0);
+
+  insert(2, "/B/long/name");
+  size_t sizeB = cs.getNBytes() - sizeA;
+  BOOST_CHECK_GT(sizeB, sizeA);
+
+  // refresh does not change the total
+  insert(1, "/A");
+  BOOST_CHECK_EQUAL(cs.getNBytes(), sizeA + sizeB);
+
+  BOOST_CHECK_EQUAL(erase("/A", 1), 1);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), sizeB);
+
+  // byte limit survives a policy change
+  cs.setLimitBytes(sizeB);
+  BOOST_CHECK_EQUAL(erase("/", 1), 1);
+  cs.setPolicy(make_unique<cs::LruPolicy>());
+  BOOST_CHECK_EQUAL(cs.getLimitBytes(), sizeB);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CompactCopy)
+{
+  // Data that shares a much larger buffer, as decoded without copying by a face
+  Block wire = makeData("/A")->wireEncode();
+  auto buffer = make_shared<ndn::Buffer>(wire.size() * 4);
+  std::copy(wire.begin(), wire.end(), buffer->begin());
+  auto data = make_shared<Data>(Block(buffer, buffer->begin(), buffer->begin() + wire.size()));
+
+  cs.insert(*data);
+  BOOST_REQUIRE_EQUAL(cs.size(), 1);
+  const Data& stored = cs.begin()->getData();
+  BOOST_CHECK_NE(&stored, data.get());
+  BOOST_CHECK_EQUAL(stored.wireEncode().getBuffer()->size(), wire.size());
+  BOOST_CHECK_EQUAL(stored.getFullName(), data->getFullName());
+  BOOST_CHECK_EQUAL(cs.getNBytes(), wire.size());
+
+  // Data that owns its buffer is stored as is
+  auto data2 = makeData("/B");
+  cs.insert(*data2);
+  BOOST_REQUIRE_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(&std::next(cs.begin())->getData(), data2.get());
+}
+
 BOOST_AUTO_TEST_CASE(EnablementFlags)
 {
   BOOST_CHECK_EQUAL(cs.shouldAdmit(), true);
@@ -95,6 +95,27 @@ BOOST_AUTO_TEST_CASE(NoDuplicates)
   BOOST_CHECK_EQUAL(dnl.has(nameA, nonce5), true);
 }
 
+BOOST_AUTO_TEST_CASE(ManyDuplicates)
+{
+  Name nameA("ndn:/A");
+  DeadNonceList dnl;
+
+  // re-adding entries leaves tombstones in the buffer, which must not count toward
+  // size or capacity, and must eventually be reclaimed
+  const uint32_t N_NONCES = 3000;
+  for (int round = 0; round < 20; ++round) {
+    for (uint32_t i = 0; i < N_NONCES; ++i) {
+      dnl.add(nameA, Interest::Nonce(i));
+    }
+    BOOST_CHECK_EQUAL(dnl.size(), N_NONCES);
+  }
+
+  for (uint32_t i = 0; i < N_NONCES; ++i) {
+    BOOST_CHECK_EQUAL(dnl.has(nameA, Interest::Nonce(i)), true);
+  }
+  BOOST_CHECK_EQUAL(dnl.has(nameA, Interest::Nonce(N_NONCES)), false);
+}
+
 BOOST_AUTO_TEST_CASE(MinLifetime)
 {
   BOOST_CHECK_THROW(DeadNonceList(0_ms), std::invalid_argument);
@@ -244,6 +244,49 @@ BOOST_AUTO_TEST_CASE(LongestPrefixMatchWithMeasurementsEntry)
   BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(mABCD).getPrefix(), "/A/B/C");
 }
 
+BOOST_AUTO_TEST_CASE(LongestPrefixMatchCacheInvalidation)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  Pit pit(nameTree);
+
+  shared_ptr<Interest> interestABC = makeInterest("/A/B/C");
+  shared_ptr<pit::Entry> pitABC = pit.insert(*interestABC).first;
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/");
+
+  fib.insert("/A");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/A");
+
+  fib.insert("/A/B");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/A/B");
+
+  fib.erase("/A/B");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/A");
+
+  fib.erase("/A");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/");
+}
+
+BOOST_AUTO_TEST_CASE(LongestPrefixMatchCacheSharedNameTreeEntry)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  Pit pit(nameTree);
+
+  // PIT entries for /A and /A/<implicit-digest> are both attached to name tree entry /A
+  Name fullName = makeData("/A")->getFullName();
+  fib.insert(fullName);
+  shared_ptr<pit::Entry> pitA = pit.insert(*makeInterest("/A")).first;
+  shared_ptr<pit::Entry> pitFull = pit.insert(*makeInterest(fullName)).first;
+  BOOST_REQUIRE_EQUAL(nameTree.getEntry(*pitA), nameTree.getEntry(*pitFull));
+
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitA).getPrefix(), "/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitFull).getPrefix(), fullName);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitA).getPrefix(), "/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitFull).getPrefix(), fullName);
+}
+
 static void
 validateFindExactMatch(Fib& fib, const Name& target)
 {
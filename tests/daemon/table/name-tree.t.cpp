@@ -31,11 +31,13 @@
 #include <unordered_set>
 
 #include <boost/range/concepts.hpp>
+#include <boost/test/data/test_case.hpp>
 #include <ndn-cxx/util/concepts.hpp>
 
 namespace nfd::tests {
 
 using namespace nfd::name_tree;
+namespace bdata = boost::unit_test::data;
 
 NDN_CXX_ASSERT_FORWARD_ITERATOR(NameTree::const_iterator);
 BOOST_CONCEPT_ASSERT((boost::ForwardRangeConcept<Range>));
@@ -59,13 +61,80 @@ BOOST_AUTO_TEST_CASE(ComputeHash)
   BOOST_CHECK_EQUAL(hashes.size(), 3);
 }
 
+const HashKernel hashKernels[] = {HashKernel::SCALAR, HashKernel::SSE42};
+
+BOOST_DATA_TEST_CASE(Kernels, bdata::make(hashKernels), kernel)
+{
+  if (!isHashKernelSupported(kernel)) {
+    BOOST_TEST_MESSAGE("skipping unsupported kernel " << kernel);
+    return;
+  }
+
+  // component sizes cover whole words, partial words, and components shorter than a word
+  Name name("/A/8bytes/nine-byte/a-sixteen-bytes/" + std::string(40, 'x') + "/seq=1234");
+  HashSequence hashes = computeHashes(name, name.size(), kernel);
+  BOOST_REQUIRE_EQUAL(hashes.size(), name.size() + 1);
+  BOOST_CHECK_EQUAL(hashes[0], 0);
+  for (size_t i = 1; i <= name.size(); ++i) {
+    BOOST_CHECK_NE(hashes[i], hashes[i - 1]);
+    BOOST_CHECK_EQUAL(hashes[i], computeHashes(name.getPrefix(i), i, kernel).back());
+  }
+
+  // changing any component changes the hash value
+  HashValue h = hashes.back();
+  for (size_t i = 0; i < name.size(); ++i) {
+    Name changed = name.getPrefix(i)
+                   .append(name::Component::fromEscapedString(name[i].toUri() + "_"))
+                   .append(name.getSubName(i + 1));
+    BOOST_CHECK_NE(computeHashes(changed, changed.size(), kernel).back(), h);
+  }
+
+  if (kernel == getHashKernel()) {
+    BOOST_CHECK(hashes == computeHashes(name));
+    BOOST_CHECK_EQUAL(hashes.back(), computeHash(name));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PacketHashes)
+{
+  auto interest = makeInterest("/A/B/C");
+  BOOST_CHECK(interest->getTag<HashSequenceTag>() == nullptr);
+
+  const HashSequence& hashes = getHashes(*interest);
+  BOOST_CHECK(hashes == computeHashes(interest->getName()));
+  BOOST_CHECK(interest->getTag<HashSequenceTag>() != nullptr);
+  BOOST_CHECK_EQUAL(&getHashes(*interest), &hashes); // cached
+
+  interest->setName("/D/E");
+  const HashSequence& hashes2 = getHashes(*interest);
+  BOOST_CHECK_EQUAL(hashes2.size(), 3);
+  BOOST_CHECK(hashes2 == computeHashes("/D/E"));
+
+  Name longName;
+  for (size_t i = 0; i < NameTree::getMaxDepth() + 8; ++i) {
+    longName.appendNumber(i);
+  }
+  auto data = makeData(longName);
+  HashSequence hashes3 = getHashes(*data);
+  BOOST_CHECK_EQUAL(hashes3.size(), NameTree::getMaxDepth() + 1);
+  BOOST_CHECK_EQUAL(hashes3.back(), computeHash(longName, NameTree::getMaxDepth()));
+  BOOST_CHECK(data->getTag<HashSequenceTag>() == nullptr); // not cached on Data
+}
+
 BOOST_AUTO_TEST_SUITE(Hashtable)
 
 using name_tree::Hashtable;
 
-BOOST_AUTO_TEST_CASE(Modifiers)
+const HashtableMode hashtableModes[] = {
+  HashtableMode::CHAINING,
+  HashtableMode::OPEN_ADDRESSING,
+};
+
+BOOST_DATA_TEST_CASE(Modifiers, bdata::make(hashtableModes), mode)
 {
-  Hashtable ht(HashtableOptions(16));
+  HashtableOptions options(16);
+  options.mode = mode;
+  Hashtable ht(options);
 
   Name name("/A/B/C/D");
   HashSequence hashes = computeHashes(name);
@@ -110,9 +179,10 @@ BOOST_AUTO_TEST_CASE(Modifiers)
   BOOST_CHECK(ht.find(name, 4) == nullptr);
 }
 
-BOOST_AUTO_TEST_CASE(Resize)
+BOOST_DATA_TEST_CASE(Resize, bdata::make(hashtableModes), mode)
 {
   HashtableOptions options(9);
+  options.mode = mode;
   BOOST_CHECK_EQUAL(options.initialSize, 9);
   BOOST_CHECK_EQUAL(options.minSize, 9);
   options.minSize = 6;
@@ -190,6 +260,129 @@ BOOST_AUTO_TEST_CASE(Resize)
   BOOST_CHECK_EQUAL(ht.getNBuckets(), 6);
 }
 
+BOOST_DATA_TEST_CASE(IncrementalResize, bdata::make(hashtableModes), mode)
+{
+  HashtableOptions options(16);
+  options.mode = mode;
+  options.resizeStep = 2;
+  Hashtable ht(options);
+
+  std::vector<Name> names;
+  for (int i = 0; i < 40; ++i) {
+    names.emplace_back(Name("/R").appendNumber(i));
+  }
+
+  auto countEnumerated = [&ht] {
+    size_t n = 0;
+    for (const Node* node = ht.getNextNode(nullptr); node != nullptr; node = ht.getNextNode(node)) {
+      ++n;
+    }
+    return n;
+  };
+
+  // inserting the 9th node triggers an expansion, and each subsequent insertion migrates 2 buckets
+  for (size_t i = 0; i < 9; ++i) {
+    HashSequence hashes = computeHashes(names[i]);
+    ht.insert(names[i], names[i].size(), hashes);
+  }
+  BOOST_CHECK_EQUAL(ht.getNBuckets(), 32);
+  BOOST_CHECK_EQUAL(ht.isResizing(), true);
+  BOOST_CHECK_EQUAL(ht.getNResizeSteps(), 1);
+
+  // all nodes are reachable while migration is in progress
+  for (size_t i = 0; i < 9; ++i) {
+    const Node* node = ht.find(names[i], names[i].size());
+    BOOST_REQUIRE(node != nullptr);
+    BOOST_CHECK_EQUAL(node->entry.getName(), names[i]);
+  }
+  BOOST_CHECK_EQUAL(countEnumerated(), 9);
+
+  // erase during migration
+  const Node* node8 = ht.find(names[8], names[8].size());
+  ht.erase(const_cast<Node*>(node8));
+  BOOST_CHECK_EQUAL(ht.size(), 8);
+  BOOST_CHECK(ht.find(names[8], names[8].size()) == nullptr);
+  BOOST_CHECK_EQUAL(countEnumerated(), 8);
+  BOOST_CHECK_EQUAL(ht.getNResizeSteps(), 2);
+
+  for (size_t i = 9; i < 17; ++i) {
+    HashSequence hashes = computeHashes(names[i]);
+    ht.insert(names[i], names[i].size(), hashes);
+  }
+  BOOST_CHECK_EQUAL(ht.isResizing(), false);
+  BOOST_CHECK_EQUAL(ht.getNResizeSteps(), 8); // 16 old buckets, 2 per step
+  BOOST_CHECK_EQUAL(ht.size(), 16);
+  BOOST_CHECK_EQUAL(countEnumerated(), 16);
+
+  // crossing the next threshold while a resize is in progress completes that resize first
+  for (size_t i = 17; i < 40; ++i) {
+    HashSequence hashes = computeHashes(names[i]);
+    ht.insert(names[i], names[i].size(), hashes);
+  }
+  BOOST_CHECK_EQUAL(ht.getNBuckets(), 128);
+  BOOST_CHECK_EQUAL(ht.size(), 39);
+  for (size_t i = 0; i < 40; ++i) {
+    BOOST_CHECK_EQUAL(ht.find(names[i], names[i].size()) != nullptr, i != 8);
+  }
+  BOOST_CHECK_EQUAL(countEnumerated(), 39);
+}
+
+BOOST_AUTO_TEST_CASE(OpenAddressingProbe)
+{
+  HashtableOptions options(64);
+  options.mode = HashtableMode::OPEN_ADDRESSING;
+  options.expandLoadFactor = 0.9f;
+  Hashtable ht(options);
+
+  std::vector<Name> names;
+  for (int i = 0; i < 57; ++i) {
+    names.emplace_back(Name("/P").appendNumber(i));
+  }
+
+  std::set<const Node*> nodes;
+  for (const auto& name : names) {
+    HashSequence hashes = computeHashes(name);
+    auto [node, isNew] = ht.insert(name, name.size(), hashes);
+    BOOST_CHECK_EQUAL(isNew, true);
+    nodes.insert(node);
+  }
+  BOOST_CHECK_EQUAL(ht.size(), names.size());
+  BOOST_CHECK_EQUAL(ht.getNBuckets(), 64);
+  BOOST_CHECK_EQUAL(nodes.size(), names.size());
+
+  // every bucket holds at most one node
+  size_t nOccupied = 0;
+  for (size_t bucket = 0; bucket < ht.getNBuckets(); ++bucket) {
+    const Node* node = ht.getBucket(bucket);
+    if (node != nullptr) {
+      ++nOccupied;
+      BOOST_CHECK(node->next == nullptr);
+    }
+  }
+  BOOST_CHECK_EQUAL(nOccupied, names.size());
+
+  // enumeration visits every node exactly once
+  std::set<const Node*> enumerated;
+  for (const Node* node = ht.getNextNode(nullptr); node != nullptr; node = ht.getNextNode(node)) {
+    BOOST_CHECK(enumerated.insert(node).second);
+  }
+  BOOST_CHECK(enumerated == nodes);
+
+  // erase every other node, which exercises backward shift deletion
+  for (size_t i = 0; i < names.size(); i += 2) {
+    const Node* node = ht.find(names[i], names[i].size());
+    BOOST_REQUIRE(node != nullptr);
+    ht.erase(const_cast<Node*>(node));
+  }
+  for (size_t i = 0; i < names.size(); ++i) {
+    const Node* node = ht.find(names[i], names[i].size());
+    BOOST_CHECK_EQUAL(node != nullptr, i % 2 == 1);
+    if (node != nullptr) {
+      BOOST_CHECK_EQUAL(node->entry.getName(), names[i]);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Hashtable
 
 BOOST_AUTO_TEST_SUITE(TestEntry)
@@ -530,6 +723,32 @@ BOOST_FIXTURE_TEST_CASE(IteratorFullEnumerate, EnumerationFixture)
     .end();
 }
 
+BOOST_AUTO_TEST_CASE(IteratorFullEnumerateOpenAddressing)
+{
+  HashtableOptions options(4);
+  options.mode = HashtableMode::OPEN_ADDRESSING;
+  NameTree nt(options);
+
+  nt.lookup("/a/b/c");
+  nt.lookup("/a/b/d");
+  nt.lookup("/a/e");
+  nt.lookup("/f");
+  BOOST_CHECK_EQUAL(nt.size(), 7);
+
+  nt.eraseIfEmpty(nt.findExactMatch("/a/b/d"));
+  BOOST_CHECK_EQUAL(nt.size(), 6);
+
+  auto&& enumerable = nt.fullEnumerate();
+  EnumerationVerifier(enumerable)
+    .expect("/")
+    .expect("/a")
+    .expect("/a/b")
+    .expect("/a/b/c")
+    .expect("/a/e")
+    .expect("/f")
+    .end();
+}
+
 BOOST_FIXTURE_TEST_SUITE(IteratorPartialEnumerate, EnumerationFixture)
 
 BOOST_AUTO_TEST_CASE(Empty)
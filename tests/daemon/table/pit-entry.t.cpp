@@ -168,6 +168,69 @@ BOOST_AUTO_TEST_CASE(InOutRecords)
   BOOST_CHECK(entry.findOutRecord(*face2) == entry.out_end());
 }
 
+class RecordIndexInfo : public fw::StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 1;
+  }
+
+  explicit
+  RecordIndexInfo(size_t index)
+    : index(index)
+  {
+  }
+
+public:
+  size_t index;
+};
+
+BOOST_AUTO_TEST_CASE(ManyRecords)
+{
+  // more records than the inline capacity of the collections
+  std::vector<shared_ptr<DummyFace>> faces;
+  for (int i = 0; i < 5; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+  }
+
+  auto interest = makeInterest("/MaFqpJk7");
+  Entry entry(*interest);
+  for (size_t i = 0; i < faces.size(); ++i) {
+    auto in = entry.insertOrUpdateInRecord(*faces[i], *interest);
+    BOOST_CHECK_EQUAL(&in->getFace(), faces[i].get());
+    in->insertStrategyInfo<RecordIndexInfo>(i);
+    entry.insertOrUpdateOutRecord(*faces[i], *interest);
+  }
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), faces.size());
+  BOOST_CHECK_EQUAL(entry.getOutRecords().size(), faces.size());
+
+  entry.deleteInRecord(entry.findInRecord(*faces[2]));
+  entry.deleteOutRecord(*faces[2]);
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), faces.size() - 1);
+  BOOST_CHECK_EQUAL(entry.getOutRecords().size(), faces.size() - 1);
+
+  for (size_t i = 0; i < faces.size(); ++i) {
+    auto in = entry.findInRecord(*faces[i]);
+    auto out = entry.findOutRecord(*faces[i]);
+    if (i == 2) {
+      BOOST_CHECK(in == entry.in_end());
+      BOOST_CHECK(out == entry.out_end());
+      continue;
+    }
+    BOOST_REQUIRE(in != entry.in_end());
+    BOOST_REQUIRE(out != entry.out_end());
+    BOOST_CHECK_EQUAL(&in->getFace(), faces[i].get());
+    BOOST_CHECK_EQUAL(&out->getFace(), faces[i].get());
+
+    // strategy info moves along with its record
+    auto info = in->getStrategyInfo<RecordIndexInfo>();
+    BOOST_REQUIRE(info != nullptr);
+    BOOST_CHECK_EQUAL(info->index, i);
+  }
+}
+
 const time::milliseconds lifetimes[] = {
   -1_ms, // unset
   1_ms,
@@ -256,6 +256,45 @@ BOOST_AUTO_TEST_CASE(FindEffectiveStrategyWithMeasurementsEntry)
   BOOST_CHECK_EQUAL(this->findInstanceName(mABCD), strategyNameQ);
 }
 
+BOOST_AUTO_TEST_CASE(FindEffectiveStrategyCacheInvalidation)
+{
+  BOOST_CHECK(sc.insert("/A", strategyNameP));
+
+  Pit& pit = forwarder.getPit();
+  shared_ptr<Interest> interestABC = makeInterest("/A/B/C");
+  shared_ptr<pit::Entry> pitABC = pit.insert(*interestABC).first;
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP);
+
+  BOOST_CHECK(sc.insert("/A/B", strategyNameQ));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameQ);
+
+  // replacing the strategy object on an existing entry must not leave a dangling cache
+  BOOST_CHECK(sc.insert("/A/B", strategyNameP));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP);
+
+  sc.erase("/A/B");
+  sc.erase("/A");
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), this->findInstanceName("/"));
+}
+
+BOOST_AUTO_TEST_CASE(FindEffectiveStrategyCacheSharedNameTreeEntry)
+{
+  // PIT entries for /A and /A/<implicit-digest> are both attached to name tree entry /A
+  Name fullName = makeData("/A")->getFullName();
+  BOOST_CHECK(sc.insert("/A", strategyNameP));
+  BOOST_CHECK(sc.insert(fullName, strategyNameQ));
+
+  Pit& pit = forwarder.getPit();
+  shared_ptr<pit::Entry> pitA = pit.insert(*makeInterest("/A")).first;
+  shared_ptr<pit::Entry> pitFull = pit.insert(*makeInterest(fullName)).first;
+
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitA), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitFull), strategyNameQ);
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitA), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitFull), strategyNameQ);
+}
+
 BOOST_AUTO_TEST_CASE(Erase)
 {
   NameTree& nameTree = forwarder.getNameTree();
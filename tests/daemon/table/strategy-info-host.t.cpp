@@ -127,6 +127,43 @@ BOOST_AUTO_TEST_CASE(Types)
   BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfo>(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(EraseReorder)
+{
+  class DummyStrategyInfo3 : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 3;
+    }
+  };
+
+  StrategyInfoHost host;
+  g_DummyStrategyInfo_count = 0;
+
+  host.insertStrategyInfo<DummyStrategyInfo>(1);
+  host.insertStrategyInfo<DummyStrategyInfo2>(2);
+  host.insertStrategyInfo<DummyStrategyInfo3>();
+
+  // erasing a non-last item keeps the others reachable
+  BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfo>(), 1);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 0);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfo>() == nullptr);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo2>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo2>()->m_id, 2);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfo3>() != nullptr);
+
+  // re-inserting after erase creates a new item
+  auto [info, isNew] = host.insertStrategyInfo<DummyStrategyInfo>(4);
+  BOOST_CHECK_EQUAL(isNew, true);
+  BOOST_CHECK_EQUAL(info->m_id, 4);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 1);
+
+  host.clearStrategyInfo();
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestStrategyInfoHost
 BOOST_AUTO_TEST_SUITE_END() // Table
 
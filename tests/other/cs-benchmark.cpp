@@ -210,4 +210,32 @@ BOOST_FIXTURE_TEST_CASE(FindCanBePrefixHit, CsBenchmarkFixture)
   std::cout << "find(CanBePrefix-hit) " << (N_INTERESTS * N_CHILDREN * REPEAT) << ": " << d << std::endl;
 }
 
+// find(exact) hit in a large CS, with and without the name index
+BOOST_FIXTURE_TEST_CASE(FindExactHitLarge, CsBenchmarkFixture)
+{
+  constexpr size_t N_ENTRIES = 1000000;
+  constexpr size_t REPEAT = 4;
+
+  cs.setLimit(N_ENTRIES);
+  std::vector<shared_ptr<Interest>> interestWorkload = makeInterestWorkload(N_ENTRIES);
+  for (const auto& interest : interestWorkload) {
+    cs.insert(*makeData(interest->getName()), false);
+  }
+  BOOST_REQUIRE(cs.size() == N_ENTRIES);
+
+  for (bool wantNameIndex : {false, true}) {
+    cs.enableNameIndex(wantNameIndex);
+    time::microseconds d = timedRun([&] {
+      for (size_t j = 0; j < REPEAT; ++j) {
+        for (const auto& interest : interestWorkload) {
+          find(*interest);
+        }
+      }
+    });
+
+    std::cout << "find(exact-hit," << (wantNameIndex ? "indexed" : "ordered") << ") "
+              << (N_ENTRIES * REPEAT) << ": " << d << std::endl;
+  }
+}
+
 } // namespace nfd::tests
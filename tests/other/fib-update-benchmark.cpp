@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "common/global.hpp"
+#include "face/null-face.hpp"
+#include "fw/face-table.hpp"
+#include "mgmt/fib-update-channel.hpp"
+#include "table/fib.hpp"
+
+#include <boost/asio/io_context.hpp>
+
+#include <array>
+#include <iostream>
+
+#ifdef NFD_HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd::tests {
+
+using rib::FibUpdate;
+
+class FibUpdateBenchmarkFixture
+{
+protected:
+  FibUpdateBenchmarkFixture()
+  {
+#ifndef NDEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    for (auto& face : m_faces) {
+      face = face::makeNullFace();
+      m_faceTable.add(face);
+    }
+  }
+
+  /** \brief Generates \p nRoutes updates with \p action, in batches of \p batchSize.
+   */
+  std::vector<std::vector<FibUpdate>>
+  makeBatches(size_t nRoutes, size_t batchSize, FibUpdate::Action action) const
+  {
+    std::vector<std::vector<FibUpdate>> batches;
+    for (size_t i = 0; i < nRoutes; ++i) {
+      if (i % batchSize == 0) {
+        batches.emplace_back();
+        batches.back().reserve(batchSize);
+      }
+      Name prefix("/bench");
+      prefix.append(std::to_string(i % 1000)).append(std::to_string(i));
+      uint64_t faceId = m_faces[i % m_faces.size()]->getId();
+      batches.back().push_back(action == FibUpdate::ADD_NEXTHOP ?
+                               FibUpdate::createAddUpdate(prefix, faceId, 10) :
+                               FibUpdate::createRemoveUpdate(prefix, faceId));
+    }
+    return batches;
+  }
+
+  /** \brief Submits all batches, then runs the io_context until all of them complete.
+   */
+  time::microseconds
+  timedApply(std::vector<std::vector<FibUpdate>> batches)
+  {
+    size_t nPending = batches.size();
+#ifdef NFD_HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = time::steady_clock::now();
+    for (auto& batch : batches) {
+      m_channel.submit(std::move(batch), 0,
+                       [&] { --nPending; },
+                       [&] (auto&&...) { --nPending; });
+    }
+    m_io.restart();
+    m_io.run();
+    auto t2 = time::steady_clock::now();
+
+#ifdef NFD_HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    BOOST_CHECK_EQUAL(nPending, 0);
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  void
+  printCounters() const
+  {
+    const auto& counters = m_channel.getCounters();
+    uint64_t nUpdates = counters.nUpdates.load();
+    uint64_t applyTime = counters.applyTime.load();
+    std::cout << "  total: batches=" << counters.nBatches.load()
+              << " updates=" << nUpdates
+              << " apply-time=" << time::nanoseconds(applyTime)
+              << " queueing-delay=" << time::nanoseconds(counters.queueingDelay.load())
+              << " throughput=" << (applyTime > 0 ? nUpdates * 1000000000 / applyTime : 0)
+              << "/s" << std::endl;
+  }
+
+protected:
+  // completions are delivered to the io_context of the submitting thread
+  boost::asio::io_context& m_io = getGlobalIoService();
+  FaceTable m_faceTable;
+  NameTree m_nameTree;
+  Fib m_fib{m_nameTree};
+  FibUpdateChannel m_channel{m_fib, m_faceTable, m_io};
+  std::array<shared_ptr<Face>, 4> m_faces;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FibUpdateBenchmark, FibUpdateBenchmarkFixture)
+
+// load and then withdraw 1M routes, e.g., after a routing daemon restart or a face flap
+BOOST_AUTO_TEST_CASE(LoadMillionRoutes)
+{
+  constexpr size_t N_ROUTES = 1000000;
+
+  for (size_t batchSize : {1, 100, 10000}) {
+    auto d = timedApply(makeBatches(N_ROUTES, batchSize, FibUpdate::ADD_NEXTHOP));
+    BOOST_CHECK_EQUAL(m_fib.size(), N_ROUTES);
+    std::cout << "add batch-size=" << batchSize << ": " << d << std::endl;
+    printCounters();
+
+    d = timedApply(makeBatches(N_ROUTES, batchSize, FibUpdate::REMOVE_NEXTHOP));
+    BOOST_CHECK_EQUAL(m_fib.size(), 0);
+    std::cout << "remove batch-size=" << batchSize << ": " << d << std::endl;
+    printCounters();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nfd::tests
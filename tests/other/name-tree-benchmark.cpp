@@ -0,0 +1,118 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "table/name-tree-hashtable.hpp"
+
+#include <iostream>
+
+#ifdef NFD_HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd::tests {
+
+using namespace nfd::name_tree;
+
+class NameTreeBenchmarkFixture
+{
+protected:
+  NameTreeBenchmarkFixture()
+  {
+#ifndef NDEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+  }
+
+  template<typename F>
+  static time::microseconds
+  timedRun(const F& f)
+  {
+#ifdef NFD_HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = time::steady_clock::now();
+    f();
+    auto t2 = time::steady_clock::now();
+
+#ifdef NFD_HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  /** \brief Generates names with a mix of component sizes, similar to application data names.
+   */
+  static std::vector<Name>
+  makeNameWorkload(size_t count)
+  {
+    std::vector<Name> workload(count);
+    for (size_t i = 0; i < count; ++i) {
+      Name& name = workload[i];
+      name = Name("/ndn/edu/university/department/application-" + std::to_string(i % 97));
+      name.appendVersion(i % 13);
+      name.appendSegment(i);
+      name.wireEncode();
+    }
+    return workload;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(NameTreeBenchmark, NameTreeBenchmarkFixture)
+
+// computeHashes with each supported kernel
+BOOST_AUTO_TEST_CASE(HashKernels)
+{
+  constexpr size_t N_NAMES = 100000;
+  constexpr size_t REPEAT = 50;
+
+  std::vector<Name> workload = makeNameWorkload(N_NAMES);
+  std::cout << "selected kernel: " << getHashKernel() << std::endl;
+
+  for (auto kernel : {HashKernel::SCALAR, HashKernel::SSE42}) {
+    if (!isHashKernelSupported(kernel)) {
+      std::cout << kernel << ": unsupported" << std::endl;
+      continue;
+    }
+
+    HashValue sum = 0;
+    time::microseconds d = timedRun([&] {
+      for (size_t j = 0; j < REPEAT; ++j) {
+        for (const Name& name : workload) {
+          sum += computeHashes(name, name.size(), kernel).back();
+        }
+      }
+    });
+
+    // print the sum so that the computation is not optimized away
+    std::cout << kernel << " " << (N_NAMES * REPEAT) << ": " << d << " (" << sum << ")" << std::endl;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // NameTreeBenchmark
+
+} // namespace nfd::tests
@@ -146,6 +146,44 @@ BOOST_FIXTURE_TEST_CASE(SimpleExchanges, PitFibBenchmarkFixture)
 #endif
 
   std::cout << time::duration_cast<time::microseconds>(t2 - t1) << std::endl;
+  std::cout << "NameTree resize steps: " << m_nameTree.getNResizeSteps() << std::endl;
+}
+
+// This test case measures the worst-case latency of a single PIT insertion while the NameTree
+// grows from empty, with all-at-once and with incremental hashtable resizing.
+BOOST_AUTO_TEST_CASE(ResizeLatency)
+{
+  // number of Interests inserted, each creating two NameTree entries
+  const size_t nInterests = 1000000;
+
+  std::vector<shared_ptr<Interest>> interests;
+  interests.reserve(nInterests);
+  for (size_t i = 0; i < nInterests; ++i) {
+    interests.push_back(make_shared<Interest>(Name("/resize").appendNumber(i).append("dup")));
+  }
+
+  for (size_t resizeStep : {0, 64}) {
+    name_tree::HashtableOptions options(1024);
+    options.resizeStep = resizeStep;
+    NameTree nameTree(options);
+    Pit pit(nameTree);
+    time::nanoseconds maxLatency = 0_ns;
+
+    auto t1 = time::steady_clock::now();
+
+    for (const auto& interest : interests) {
+      auto t = time::steady_clock::now();
+      pit.insert(*interest);
+      maxLatency = std::max(maxLatency, time::steady_clock::now() - t);
+    }
+
+    auto t2 = time::steady_clock::now();
+
+    std::cout << "resizeStep=" << resizeStep
+              << " total=" << time::duration_cast<time::microseconds>(t2 - t1)
+              << " max=" << time::duration_cast<time::microseconds>(maxLatency)
+              << " resizeSteps=" << nameTree.getNResizeSteps() << std::endl;
+  }
 }
 
 } // namespace nfd::tests
@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "rib/rib.hpp"
+#include "tests/daemon/rib/create-route.hpp"
+
+#include <iostream>
+
+#ifdef NFD_HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd::tests {
+
+class RibBenchmarkFixture
+{
+protected:
+  RibBenchmarkFixture()
+  {
+#ifndef NDEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+  }
+
+  template<typename F>
+  static time::microseconds
+  timedRun(const F& f)
+  {
+#ifdef NFD_HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    auto t1 = time::steady_clock::now();
+    f();
+    auto t2 = time::steady_clock::now();
+
+#ifdef NFD_HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  /** \brief Generates names resembling routes announced by a link-state routing protocol.
+   */
+  static std::vector<Name>
+  makeRouteWorkload(size_t count)
+  {
+    std::vector<Name> workload(count);
+    for (size_t i = 0; i < count; ++i) {
+      Name& name = workload[i];
+      name = Name("/ndn/site-" + std::to_string(i % 500));
+      name.append("router-" + std::to_string(i % 47));
+      name.append("prefix-" + std::to_string(i));
+    }
+    return workload;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(RibBenchmark, RibBenchmarkFixture)
+
+// load 1M routes, then add site-level prefixes that adopt existing entries as children
+BOOST_AUTO_TEST_CASE(LoadMillionRoutes)
+{
+  constexpr size_t N_ROUTES = 1000000;
+  constexpr size_t N_SITES = 500;
+
+  std::vector<Name> workload = makeRouteWorkload(N_ROUTES);
+  rib::Rib rib;
+
+  auto d = timedRun([&] {
+    for (size_t i = 0; i < N_ROUTES; ++i) {
+      rib.insert(workload[i], createRoute(i % 64 + 300, 0, 10));
+    }
+  });
+  BOOST_CHECK_EQUAL(rib.size(), N_ROUTES);
+  std::cout << "insert " << N_ROUTES << " routes: " << d << std::endl;
+
+  size_t nFound = 0;
+  d = timedRun([&] {
+    for (const Name& name : workload) {
+      nFound += rib.findParent(name) != nullptr;
+    }
+  });
+  // print the count so that the lookups are not optimized away
+  std::cout << "findParent " << N_ROUTES << " names: " << d << " (" << nFound << ")" << std::endl;
+
+  d = timedRun([&] {
+    for (size_t i = 0; i < N_SITES; ++i) {
+      rib.insert(Name("/ndn/site-" + std::to_string(i)),
+                 createRoute(1, 0, 10, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT));
+    }
+  });
+  BOOST_CHECK_EQUAL(rib.size(), N_ROUTES + N_SITES);
+  std::cout << "insert " << N_SITES << " covering prefixes: " << d << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nfd::tests
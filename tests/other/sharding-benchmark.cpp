@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2024,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "table/fib.hpp"
+#include "table/name-tree-hashtable.hpp"
+#include "table/pit.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace nfd::tests {
+
+// Selects the shard of a packet from the hash of its first name component. Every name in this
+// workload has at least two components and no Interest has CanBePrefix, so an Interest and its
+// Data always go to the same shard. That does not hold for arbitrary traffic.
+template<typename Packet>
+static size_t
+selectShard(const Packet& packet, size_t nShards)
+{
+  // Fibonacci hashing, so that the shard does not depend only on the bits that also select
+  // the NameTree bucket within a shard
+  uint64_t x = static_cast<uint64_t>(name_tree::getHashes(packet)[1]) * 0x9E3779B97F4A7C15;
+  return static_cast<size_t>((x >> 32) % nShards);
+}
+
+// This test case models PIT and FIB operations of sharded forwarding, where each of nShards
+// shards owns a NameTree and PIT, and a replica of the FIB. NameTree nodes are allocated from a
+// MemoryPool that is not thread-safe, so the shards cannot run on their own threads. Instead,
+// each shard processes its share of the workload in turn, and the time of the slowest shard is
+// reported next to the total time. The former is the lower bound of the time that nShards cores
+// would take, not counting the cost of dispatching packets across cores.
+BOOST_AUTO_TEST_CASE(ShardedExchanges)
+{
+#ifndef NDEBUG
+  std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+  // number of Interest-Data exchanges
+  const size_t nRoundTrip = 1000000;
+  // number of iterations between processing an Interest and processing its Data
+  const size_t replyGap = 20000;
+  // number of FIB entries, which are also the top-level prefixes used for sharding
+  const size_t nFibEntries = 2000;
+  // largest number of shards
+  const size_t maxShards = 16;
+
+  std::vector<Name> fibPrefixes;
+  for (size_t i = 0; i < nFibEntries; ++i) {
+    fibPrefixes.emplace_back("/" + std::to_string(i));
+  }
+  std::vector<shared_ptr<Interest>> interests;
+  std::vector<shared_ptr<Data>> data;
+  for (size_t i = 0; i < nRoundTrip; ++i) {
+    Name name = Name(fibPrefixes[i % nFibEntries]).appendNumber(i);
+    interests.push_back(make_shared<Interest>(name));
+    data.push_back(make_shared<Data>(Name(name).append("dup")));
+  }
+
+  for (size_t nShards = 1; nShards <= maxShards; nShards *= 2) {
+    // packets of each shard, in the order a dispatcher would hand them out;
+    // a packet is an Interest if the boolean is false, a Data otherwise
+    std::vector<std::vector<std::pair<const void*, bool>>> shardPackets(nShards);
+    for (size_t i = 0; i < nRoundTrip + replyGap; ++i) {
+      if (i < nRoundTrip) {
+        shardPackets[selectShard(*interests[i], nShards)].emplace_back(interests[i].get(), false);
+      }
+      if (i >= replyGap) {
+        const Data& d = *data[i - replyGap];
+        shardPackets[selectShard(d, nShards)].emplace_back(&d, true);
+      }
+    }
+
+    time::nanoseconds total = 0_ns;
+    time::nanoseconds slowest = 0_ns;
+    for (const auto& packets : shardPackets) {
+      NameTree nameTree;
+      Fib fib(nameTree);
+      Pit pit(nameTree);
+      for (const auto& prefix : fibPrefixes) {
+        fib.insert(prefix);
+      }
+
+      auto t1 = time::steady_clock::now();
+
+      for (const auto& [packet, isData] : packets) {
+        if (!isData) {
+          // process incoming Interest
+          auto pitEntry = pit.insert(*static_cast<const Interest*>(packet)).first;
+          fib.findLongestPrefixMatch(*pitEntry);
+        }
+        else {
+          // process incoming Data, deleting matching PIT entries
+          auto matches = pit.findAllDataMatches(*static_cast<const Data*>(packet));
+          for (const auto& pitEntry : matches) {
+            pit.erase(pitEntry.get());
+          }
+        }
+      }
+
+      auto t2 = time::steady_clock::now();
+      total += t2 - t1;
+      slowest = std::max(slowest, t2 - t1);
+    }
+
+    std::cout << "shards=" << nShards
+              << " total=" << time::duration_cast<time::microseconds>(total)
+              << " slowest-shard=" << time::duration_cast<time::microseconds>(slowest)
+              << std::endl;
+  }
+}
+
+} // namespace nfd::tests